@@ -0,0 +1,49 @@
+import React from 'react';
+import {requireNativeComponent} from 'react-native';
+
+// SMIL attributes as written in SVG markup, evaluated natively each frame.
+export interface AnimateProps {
+  id?: string;
+  attributeName?: string;
+  begin?: string;
+  dur?: string;
+  end?: string;
+  repeatCount?: string | number;
+  fill?: 'freeze' | 'remove';
+  calcMode?: 'discrete' | 'linear' | 'paced' | 'spline';
+  values?: string;
+  keyTimes?: string;
+  keySplines?: string;
+  keyPoints?: string;
+  from?: string | number;
+  to?: string | number;
+  path?: string;
+  rotate?: string | number;
+  type?: 'translate' | 'scale' | 'rotate' | 'skewX' | 'skewY';
+  href?: string;
+}
+
+type Element = 'animate' | 'set' | 'animateTransform' | 'animateMotion';
+
+const RNSVGAnimate = requireNativeComponent<
+  Omit<AnimateProps, 'id'> & {name?: string; element: Element}
+>('RNSVGAnimate');
+
+function create(element: Element) {
+  return ({id, repeatCount, from, to, rotate, ...props}: AnimateProps) => (
+    <RNSVGAnimate
+      {...props}
+      name={id}
+      element={element}
+      repeatCount={repeatCount === undefined ? undefined : String(repeatCount)}
+      from={from === undefined ? undefined : String(from)}
+      to={to === undefined ? undefined : String(to)}
+      rotate={rotate === undefined ? undefined : String(rotate)}
+    />
+  );
+}
+
+export const Animate = create('animate');
+export const Set = create('set');
+export const AnimateTransform = create('animateTransform');
+export const AnimateMotion = create('animateMotion');
@@ -0,0 +1,163 @@
+import React from 'react';
+import {requireNativeComponent} from 'react-native';
+import {G as SvgG} from 'react-native-svg';
+import type {GProps} from 'react-native-svg';
+
+type NumberProp = string | number;
+
+// Attributes every primitive takes, as written in SVG markup.
+export interface FilterPrimitiveProps {
+  x?: NumberProp;
+  y?: NumberProp;
+  width?: NumberProp;
+  height?: NumberProp;
+  result?: string;
+  in?: string;
+}
+
+export interface FilterProps {
+  id?: string;
+  x?: NumberProp;
+  y?: NumberProp;
+  width?: NumberProp;
+  height?: NumberProp;
+  filterUnits?: 'objectBoundingBox' | 'userSpaceOnUse';
+  primitiveUnits?: 'objectBoundingBox' | 'userSpaceOnUse';
+  children?: React.ReactNode;
+}
+
+export interface FeGaussianBlurProps extends FilterPrimitiveProps {
+  stdDeviation?: NumberProp | [NumberProp, NumberProp];
+  edgeMode?: 'duplicate' | 'wrap' | 'none';
+}
+
+export interface FeOffsetProps extends FilterPrimitiveProps {
+  dx?: NumberProp;
+  dy?: NumberProp;
+}
+
+export interface FeFloodProps extends FilterPrimitiveProps {
+  floodColor?: string;
+  floodOpacity?: NumberProp;
+}
+
+export interface FeBlendProps extends FilterPrimitiveProps {
+  in2?: string;
+  mode?: 'normal' | 'multiply' | 'screen' | 'darken' | 'lighten';
+}
+
+export interface FeCompositeProps extends FilterPrimitiveProps {
+  in2?: string;
+  operator?: 'over' | 'in' | 'out' | 'atop' | 'xor' | 'arithmetic' | 'lighter';
+  k1?: NumberProp;
+  k2?: NumberProp;
+  k3?: NumberProp;
+  k4?: NumberProp;
+}
+
+export interface FeColorMatrixProps extends FilterPrimitiveProps {
+  type?: 'matrix' | 'saturate' | 'hueRotate' | 'luminanceToAlpha';
+  values?: NumberProp | NumberProp[];
+}
+
+// the native props are all strings, parsed like SVG attributes
+type NativeProps = {[name: string]: string | undefined | React.ReactNode};
+
+function toString(value: NumberProp | NumberProp[] | undefined) {
+  if (value === undefined) {
+    return undefined;
+  }
+  return Array.isArray(value) ? value.join(' ') : String(value);
+}
+
+function primitive<P extends FilterPrimitiveProps>(
+  name: string,
+  toNative: (props: P) => NativeProps,
+) {
+  const Native = requireNativeComponent<NativeProps>(name);
+  return (props: P) => (
+    <Native
+      x={toString(props.x)}
+      y={toString(props.y)}
+      width={toString(props.width)}
+      height={toString(props.height)}
+      result={props.result}
+      in1={props.in}
+      {...toNative(props)}
+    />
+  );
+}
+
+const RNSVGFilter = requireNativeComponent<NativeProps>('RNSVGFilter');
+
+export const Filter = ({id, x, y, width, height, ...props}: FilterProps) => (
+  <RNSVGFilter
+    {...props}
+    name={id}
+    x={toString(x)}
+    y={toString(y)}
+    width={toString(width)}
+    height={toString(height)}
+  />
+);
+
+export const FeGaussianBlur = primitive<FeGaussianBlurProps>(
+  'RNSVGFeGaussianBlur',
+  ({stdDeviation, edgeMode}) => {
+    const [x, y] = Array.isArray(stdDeviation)
+      ? stdDeviation
+      : [stdDeviation, stdDeviation];
+    return {stdDeviationX: toString(x), stdDeviationY: toString(y), edgeMode};
+  },
+);
+
+export const FeOffset = primitive<FeOffsetProps>('RNSVGFeOffset', ({dx, dy}) => ({
+  dx: toString(dx),
+  dy: toString(dy),
+}));
+
+export const FeFlood = primitive<FeFloodProps>(
+  'RNSVGFeFlood',
+  ({floodColor, floodOpacity}) => ({
+    floodColor,
+    floodOpacity: toString(floodOpacity),
+  }),
+);
+
+export const FeBlend = primitive<FeBlendProps>('RNSVGFeBlend', ({in2, mode}) => ({
+  in2,
+  mode,
+}));
+
+export const FeComposite = primitive<FeCompositeProps>(
+  'RNSVGFeComposite',
+  ({in2, operator, k1, k2, k3, k4}) => ({
+    in2,
+    operator1: operator,
+    k1: toString(k1),
+    k2: toString(k2),
+    k3: toString(k3),
+    k4: toString(k4),
+  }),
+);
+
+export const FeColorMatrix = primitive<FeColorMatrixProps>(
+  'RNSVGFeColorMatrix',
+  ({type, values}) => ({type, values: toString(values)}),
+);
+
+// react-native-svg's G drops props it does not know; this one hands the id
+// of filter="url(#id)" on to the native group.
+export class G<P = {}> extends SvgG<P & {filter?: string}> {
+  render() {
+    const element = super.render() as React.ReactElement;
+    const {filter} = this.props;
+    if (!filter) {
+      return element;
+    }
+    const match = /^url\(\s*#([^)]+?)\s*\)$/.exec(filter.trim());
+    return React.cloneElement(element, {filter: match ? match[1] : filter});
+  }
+}
+
+export type {GProps};
@@ -1,3 +1,25 @@
 import Svg from "react-native-svg"
 export * from "react-native-svg"
+export {Animate, Set, AnimateTransform, AnimateMotion} from "./Animate"
+export type {AnimateProps} from "./Animate"
+export {
+  G,
+  Filter,
+  FeGaussianBlur,
+  FeOffset,
+  FeFlood,
+  FeBlend,
+  FeComposite,
+  FeColorMatrix,
+} from "./Filter"
+export type {
+  FilterProps,
+  FilterPrimitiveProps,
+  FeGaussianBlurProps,
+  FeOffsetProps,
+  FeFloodProps,
+  FeBlendProps,
+  FeCompositeProps,
+  FeColorMatrixProps,
+} from "./Filter"
 export default Svg
\ No newline at end of file
@@ -23,6 +23,7 @@ using RNSVGDefsComponentDescriptor = ConcreteComponentDescriptor<RNSVGDefsShadow
 using RNSVGEllipseComponentDescriptor = ConcreteComponentDescriptor<RNSVGEllipseShadowNode>;
 using RNSVGForeignObjectComponentDescriptor = ConcreteComponentDescriptor<RNSVGForeignObjectShadowNode>;
 using RNSVGGroupComponentDescriptor = ConcreteComponentDescriptor<RNSVGGroupShadowNode>;
+using RNSVGImageComponentDescriptor = ConcreteComponentDescriptor<RNSVGImageShadowNode>;
 using RNSVGSvgViewComponentDescriptor = ConcreteComponentDescriptor<RNSVGSvgViewShadowNode>;
 using RNSVGLinearGradientComponentDescriptor = ConcreteComponentDescriptor<RNSVGLinearGradientShadowNode>;
 using RNSVGLineComponentDescriptor = ConcreteComponentDescriptor<RNSVGLineShadowNode>;
@@ -37,6 +38,14 @@ using RNSVGTextComponentDescriptor = ConcreteComponentDescriptor<RNSVGTextShadow
 using RNSVGTextPathComponentDescriptor = ConcreteComponentDescriptor<RNSVGTextPathShadowNode>;
 using RNSVGTSpanComponentDescriptor = ConcreteComponentDescriptor<RNSVGTSpanShadowNode>;
 using RNSVGUseComponentDescriptor = ConcreteComponentDescriptor<RNSVGUseShadowNode>;
+using RNSVGAnimateComponentDescriptor = ConcreteComponentDescriptor<RNSVGAnimateShadowNode>;
+using RNSVGFilterComponentDescriptor = ConcreteComponentDescriptor<RNSVGFilterShadowNode>;
+using RNSVGFeGaussianBlurComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeGaussianBlurShadowNode>;
+using RNSVGFeOffsetComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeOffsetShadowNode>;
+using RNSVGFeFloodComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeFloodShadowNode>;
+using RNSVGFeBlendComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeBlendShadowNode>;
+using RNSVGFeCompositeComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeCompositeShadowNode>;
+using RNSVGFeColorMatrixComponentDescriptor = ConcreteComponentDescriptor<RNSVGFeColorMatrixShadowNode>;
 
 } // namespace react
 } // namespace facebook
@@ -190,6 +190,70 @@ class JSI_EXPORT RNSVGUseEventEmitter : public ViewEventEmitter {
   
 
   
+};
+class JSI_EXPORT RNSVGAnimateEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFilterEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeGaussianBlurEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeOffsetEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeFloodEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeBlendEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeCompositeEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
+};
+class JSI_EXPORT RNSVGFeColorMatrixEventEmitter : public ViewEventEmitter {
+ public:
+  using ViewEventEmitter::ViewEventEmitter;
+
+  
+
+  
 };
 
 } // namespace react
@@ -232,6 +232,7 @@ RNSVGGroupProps::RNSVGGroupProps(
     opacity(convertRawProp(context, rawProps, "opacity", sourceProps.opacity, {1.0})),
     matrix(convertRawProp(context, rawProps, "matrix", sourceProps.matrix, {})),
     mask(convertRawProp(context, rawProps, "mask", sourceProps.mask, {})),
+    filter(convertRawProp(context, rawProps, "filter", sourceProps.filter, {})),
     markerStart(convertRawProp(context, rawProps, "markerStart", sourceProps.markerStart, {})),
     markerMid(convertRawProp(context, rawProps, "markerMid", sourceProps.markerMid, {})),
     markerEnd(convertRawProp(context, rawProps, "markerEnd", sourceProps.markerEnd, {})),
@@ -310,7 +311,8 @@ RNSVGSvgViewProps::RNSVGSvgViewProps(
     meetOrSlice(convertRawProp(context, rawProps, "meetOrSlice", sourceProps.meetOrSlice, {0})),
     tintColor(convertRawProp(context, rawProps, "tintColor", sourceProps.tintColor, {})),
     color(convertRawProp(context, rawProps, "color", sourceProps.color, {})),
-    pointerEvents(convertRawProp(context, rawProps, "pointerEvents", sourceProps.pointerEvents, {}))
+    pointerEvents(convertRawProp(context, rawProps, "pointerEvents", sourceProps.pointerEvents, {})),
+    renderMode(convertRawProp(context, rawProps, "renderMode", sourceProps.renderMode, {}))
       {}
 RNSVGLinearGradientProps::RNSVGLinearGradientProps(
     const PropsParserContext &context,
@@ -819,6 +821,133 @@ RNSVGUseProps::RNSVGUseProps(
     height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
     width(convertRawProp(context, rawProps, "width", sourceProps.width, {}))
       {}
+RNSVGAnimateProps::RNSVGAnimateProps(
+    const PropsParserContext &context,
+    const RNSVGAnimateProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    name(convertRawProp(context, rawProps, "name", sourceProps.name, {})),
+    element(convertRawProp(context, rawProps, "element", sourceProps.element, {})),
+    attributeName(convertRawProp(context, rawProps, "attributeName", sourceProps.attributeName, {})),
+    begin(convertRawProp(context, rawProps, "begin", sourceProps.begin, {})),
+    dur(convertRawProp(context, rawProps, "dur", sourceProps.dur, {})),
+    end(convertRawProp(context, rawProps, "end", sourceProps.end, {})),
+    repeatCount(convertRawProp(context, rawProps, "repeatCount", sourceProps.repeatCount, {})),
+    fill(convertRawProp(context, rawProps, "fill", sourceProps.fill, {})),
+    calcMode(convertRawProp(context, rawProps, "calcMode", sourceProps.calcMode, {})),
+    values(convertRawProp(context, rawProps, "values", sourceProps.values, {})),
+    keyTimes(convertRawProp(context, rawProps, "keyTimes", sourceProps.keyTimes, {})),
+    keySplines(convertRawProp(context, rawProps, "keySplines", sourceProps.keySplines, {})),
+    keyPoints(convertRawProp(context, rawProps, "keyPoints", sourceProps.keyPoints, {})),
+    from(convertRawProp(context, rawProps, "from", sourceProps.from, {})),
+    to(convertRawProp(context, rawProps, "to", sourceProps.to, {})),
+    path(convertRawProp(context, rawProps, "path", sourceProps.path, {})),
+    rotate(convertRawProp(context, rawProps, "rotate", sourceProps.rotate, {})),
+    type(convertRawProp(context, rawProps, "type", sourceProps.type, {})),
+    href(convertRawProp(context, rawProps, "href", sourceProps.href, {}))
+      {}
+RNSVGFilterProps::RNSVGFilterProps(
+    const PropsParserContext &context,
+    const RNSVGFilterProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    name(convertRawProp(context, rawProps, "name", sourceProps.name, {})),
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    filterUnits(convertRawProp(context, rawProps, "filterUnits", sourceProps.filterUnits, {})),
+    primitiveUnits(convertRawProp(context, rawProps, "primitiveUnits", sourceProps.primitiveUnits, {}))
+      {}
+RNSVGFeGaussianBlurProps::RNSVGFeGaussianBlurProps(
+    const PropsParserContext &context,
+    const RNSVGFeGaussianBlurProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    stdDeviationX(convertRawProp(context, rawProps, "stdDeviationX", sourceProps.stdDeviationX, {})),
+    stdDeviationY(convertRawProp(context, rawProps, "stdDeviationY", sourceProps.stdDeviationY, {})),
+    edgeMode(convertRawProp(context, rawProps, "edgeMode", sourceProps.edgeMode, {}))
+      {}
+RNSVGFeOffsetProps::RNSVGFeOffsetProps(
+    const PropsParserContext &context,
+    const RNSVGFeOffsetProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    dx(convertRawProp(context, rawProps, "dx", sourceProps.dx, {})),
+    dy(convertRawProp(context, rawProps, "dy", sourceProps.dy, {}))
+      {}
+RNSVGFeFloodProps::RNSVGFeFloodProps(
+    const PropsParserContext &context,
+    const RNSVGFeFloodProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    floodColor(convertRawProp(context, rawProps, "floodColor", sourceProps.floodColor, {})),
+    floodOpacity(convertRawProp(context, rawProps, "floodOpacity", sourceProps.floodOpacity, {}))
+      {}
+RNSVGFeBlendProps::RNSVGFeBlendProps(
+    const PropsParserContext &context,
+    const RNSVGFeBlendProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    in2(convertRawProp(context, rawProps, "in2", sourceProps.in2, {})),
+    mode(convertRawProp(context, rawProps, "mode", sourceProps.mode, {}))
+      {}
+RNSVGFeCompositeProps::RNSVGFeCompositeProps(
+    const PropsParserContext &context,
+    const RNSVGFeCompositeProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    in2(convertRawProp(context, rawProps, "in2", sourceProps.in2, {})),
+    operator1(convertRawProp(context, rawProps, "operator1", sourceProps.operator1, {})),
+    k1(convertRawProp(context, rawProps, "k1", sourceProps.k1, {})),
+    k2(convertRawProp(context, rawProps, "k2", sourceProps.k2, {})),
+    k3(convertRawProp(context, rawProps, "k3", sourceProps.k3, {})),
+    k4(convertRawProp(context, rawProps, "k4", sourceProps.k4, {}))
+      {}
+RNSVGFeColorMatrixProps::RNSVGFeColorMatrixProps(
+    const PropsParserContext &context,
+    const RNSVGFeColorMatrixProps &sourceProps,
+    const RawProps &rawProps): ViewProps(context, sourceProps, rawProps),
+
+    x(convertRawProp(context, rawProps, "x", sourceProps.x, {})),
+    y(convertRawProp(context, rawProps, "y", sourceProps.y, {})),
+    width(convertRawProp(context, rawProps, "width", sourceProps.width, {})),
+    height(convertRawProp(context, rawProps, "height", sourceProps.height, {})),
+    result(convertRawProp(context, rawProps, "result", sourceProps.result, {})),
+    in1(convertRawProp(context, rawProps, "in1", sourceProps.in1, {})),
+    type(convertRawProp(context, rawProps, "type", sourceProps.type, {})),
+    values(convertRawProp(context, rawProps, "values", sourceProps.values, {}))
+      {}
 
 } // namespace react
 } // namespace facebook
@@ -862,6 +862,7 @@ class JSI_EXPORT RNSVGGroupProps final : public ViewProps {
   Float opacity{1.0};
   std::vector<Float> matrix{};
   std::string mask{};
+  std::string filter{};
   std::string markerStart{};
   std::string markerMid{};
   std::string markerEnd{};
@@ -1000,6 +1001,7 @@ class JSI_EXPORT RNSVGSvgViewProps final : public ViewProps {
   SharedColor tintColor{};
   SharedColor color{};
   std::string pointerEvents{};
+  std::string renderMode{};
 };
 
 class JSI_EXPORT RNSVGLinearGradientProps final : public ViewProps {
@@ -2705,5 +2707,156 @@ class JSI_EXPORT RNSVGUseProps final : public ViewProps {
   std::string width{};
 };
 
+class JSI_EXPORT RNSVGAnimateProps final : public ViewProps {
+ public:
+  RNSVGAnimateProps() = default;
+  RNSVGAnimateProps(const PropsParserContext& context, const RNSVGAnimateProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string name{};
+  std::string element{};
+  std::string attributeName{};
+  std::string begin{};
+  std::string dur{};
+  std::string end{};
+  std::string repeatCount{};
+  std::string fill{};
+  std::string calcMode{};
+  std::string values{};
+  std::string keyTimes{};
+  std::string keySplines{};
+  std::string keyPoints{};
+  std::string from{};
+  std::string to{};
+  std::string path{};
+  std::string rotate{};
+  std::string type{};
+  std::string href{};
+};
+
+class JSI_EXPORT RNSVGFilterProps final : public ViewProps {
+ public:
+  RNSVGFilterProps() = default;
+  RNSVGFilterProps(const PropsParserContext& context, const RNSVGFilterProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string name{};
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string filterUnits{};
+  std::string primitiveUnits{};
+};
+
+class JSI_EXPORT RNSVGFeGaussianBlurProps final : public ViewProps {
+ public:
+  RNSVGFeGaussianBlurProps() = default;
+  RNSVGFeGaussianBlurProps(const PropsParserContext& context, const RNSVGFeGaussianBlurProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string stdDeviationX{};
+  std::string stdDeviationY{};
+  std::string edgeMode{};
+};
+
+class JSI_EXPORT RNSVGFeOffsetProps final : public ViewProps {
+ public:
+  RNSVGFeOffsetProps() = default;
+  RNSVGFeOffsetProps(const PropsParserContext& context, const RNSVGFeOffsetProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string dx{};
+  std::string dy{};
+};
+
+class JSI_EXPORT RNSVGFeFloodProps final : public ViewProps {
+ public:
+  RNSVGFeFloodProps() = default;
+  RNSVGFeFloodProps(const PropsParserContext& context, const RNSVGFeFloodProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string floodColor{};
+  std::string floodOpacity{};
+};
+
+class JSI_EXPORT RNSVGFeBlendProps final : public ViewProps {
+ public:
+  RNSVGFeBlendProps() = default;
+  RNSVGFeBlendProps(const PropsParserContext& context, const RNSVGFeBlendProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string in2{};
+  std::string mode{};
+};
+
+class JSI_EXPORT RNSVGFeCompositeProps final : public ViewProps {
+ public:
+  RNSVGFeCompositeProps() = default;
+  RNSVGFeCompositeProps(const PropsParserContext& context, const RNSVGFeCompositeProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string in2{};
+  std::string operator1{};
+  std::string k1{};
+  std::string k2{};
+  std::string k3{};
+  std::string k4{};
+};
+
+class JSI_EXPORT RNSVGFeColorMatrixProps final : public ViewProps {
+ public:
+  RNSVGFeColorMatrixProps() = default;
+  RNSVGFeColorMatrixProps(const PropsParserContext& context, const RNSVGFeColorMatrixProps &sourceProps, const RawProps &rawProps);
+
+#pragma mark - Props
+
+  std::string x{};
+  std::string y{};
+  std::string width{};
+  std::string height{};
+  std::string result{};
+  std::string in1{};
+  std::string type{};
+  std::string values{};
+};
+
 } // namespace react
 } // namespace facebook
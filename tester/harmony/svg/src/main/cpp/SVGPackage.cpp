@@ -47,6 +47,14 @@
 #include "componentBinders/RNSVGRadialGradientJSIBinder.h"
 #include "componentBinders/RNSVGSymbolJSIBinder.h"
 #include "componentBinders/RNSVGTextPathJSIBinder.h"
+#include "componentBinders/RNSVGAnimateJSIBinder.h"
+#include "componentBinders/RNSVGFilterJSIBinder.h"
+#include "componentBinders/RNSVGFeGaussianBlurJSIBinder.h"
+#include "componentBinders/RNSVGFeOffsetJSIBinder.h"
+#include "componentBinders/RNSVGFeFloodJSIBinder.h"
+#include "componentBinders/RNSVGFeBlendJSIBinder.h"
+#include "componentBinders/RNSVGFeCompositeJSIBinder.h"
+#include "componentBinders/RNSVGFeColorMatrixJSIBinder.h"
 
 using namespace rnoh;
 using namespace facebook;
@@ -60,7 +68,7 @@ std::vector<react::ComponentDescriptorProvider> SVGPackage::createComponentDescr
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGForeignObjectComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGGroupComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGSvgViewComponentDescriptor>(),
-//         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGImageComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGImageComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGLineComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGLinearGradientComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGMarkerComponentDescriptor>(),
@@ -74,6 +82,14 @@ std::vector<react::ComponentDescriptorProvider> SVGPackage::createComponentDescr
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGTextComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGTextPathComponentDescriptor>(),
         facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGUseComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGAnimateComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFilterComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeGaussianBlurComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeOffsetComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeFloodComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeBlendComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeCompositeComponentDescriptor>(),
+        facebook::react::concreteComponentDescriptorProvider<facebook::react::RNSVGFeColorMatrixComponentDescriptor>(),
     };
 }
 
@@ -105,5 +121,13 @@ ComponentJSIBinderByString rnoh::SVGPackage::createComponentJSIBinderByName() {
         {"RNSVGText", std::make_shared<RNSVGTextJSIBinder>()},
         {"RNSVGTextPath", std::make_shared<RNSVGTextPathJSIBinder>()},
         {"RNSVGUse", std::make_shared<RNSVGUseJSIBinder>()},
+        {"RNSVGAnimate", std::make_shared<RNSVGAnimateJSIBinder>()},
+        {"RNSVGFilter", std::make_shared<RNSVGFilterJSIBinder>()},
+        {"RNSVGFeGaussianBlur", std::make_shared<RNSVGFeGaussianBlurJSIBinder>()},
+        {"RNSVGFeOffset", std::make_shared<RNSVGFeOffsetJSIBinder>()},
+        {"RNSVGFeFlood", std::make_shared<RNSVGFeFloodJSIBinder>()},
+        {"RNSVGFeBlend", std::make_shared<RNSVGFeBlendJSIBinder>()},
+        {"RNSVGFeComposite", std::make_shared<RNSVGFeCompositeJSIBinder>()},
+        {"RNSVGFeColorMatrix", std::make_shared<RNSVGFeColorMatrixJSIBinder>()},
     };
 };
\ No newline at end of file
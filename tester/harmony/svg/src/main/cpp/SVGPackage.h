@@ -38,9 +38,22 @@
 #include "componentInstances/RNSVGDefsComponentInstance.h"
 #include "componentInstances/RNSVGTextComponentInstance.h"
 #include "componentInstances/RNSVGTSpanComponentInstance.h"
+#include "componentInstances/RNSVGTextPathComponentInstance.h"
 #include "componentInstances/RNSVGClipPathComponentInstance.h"
 #include "componentInstances/RNSVGMaskComponentInstance.h"
 #include "componentInstances/RNSVGUseComponentInstance.h"
+#include "componentInstances/RNSVGPatternComponentInstance.h"
+#include "componentInstances/RNSVGMarkerComponentInstance.h"
+#include "componentInstances/RNSVGSymbolComponentInstance.h"
+#include "componentInstances/RNSVGAnimateComponentInstance.h"
+#include "componentInstances/RNSVGFilterComponentInstance.h"
+#include "componentInstances/RNSVGFeGaussianBlurComponentInstance.h"
+#include "componentInstances/RNSVGFeOffsetComponentInstance.h"
+#include "componentInstances/RNSVGFeFloodComponentInstance.h"
+#include "componentInstances/RNSVGFeBlendComponentInstance.h"
+#include "componentInstances/RNSVGFeCompositeComponentInstance.h"
+#include "componentInstances/RNSVGFeColorMatrixComponentInstance.h"
+#include "turboModules/RNSVGSvgViewModule.h"
 
 using namespace rnoh;
 using namespace facebook;
@@ -88,6 +101,9 @@ public:
         if (ctx.componentName == "RNSVGTSpan") {
             return std::make_shared<RNSVGTSpanComponentInstance>(std::move(ctx));
         }
+        if (ctx.componentName == "RNSVGTextPath") {
+            return std::make_shared<RNSVGTextPathComponentInstance>(std::move(ctx));
+        }
         if (ctx.componentName == "RNSVGClipPath") {
             return std::make_shared<RNSVGClipPathComponentInstance>(std::move(ctx));
         }
@@ -97,6 +113,49 @@ public:
         if (ctx.componentName == "RNSVGUse") {
             return std::make_shared<RNSVGUseComponentInstance>(std::move(ctx));
         }
+        if (ctx.componentName == "RNSVGPattern") {
+            return std::make_shared<RNSVGPatternComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGMarker") {
+            return std::make_shared<RNSVGMarkerComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGSymbol") {
+            return std::make_shared<RNSVGSymbolComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGAnimate") {
+            return std::make_shared<RNSVGAnimateComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFilter") {
+            return std::make_shared<RNSVGFilterComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeGaussianBlur") {
+            return std::make_shared<RNSVGFeGaussianBlurComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeOffset") {
+            return std::make_shared<RNSVGFeOffsetComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeFlood") {
+            return std::make_shared<RNSVGFeFloodComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeBlend") {
+            return std::make_shared<RNSVGFeBlendComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeComposite") {
+            return std::make_shared<RNSVGFeCompositeComponentInstance>(std::move(ctx));
+        }
+        if (ctx.componentName == "RNSVGFeColorMatrix") {
+            return std::make_shared<RNSVGFeColorMatrixComponentInstance>(std::move(ctx));
+        }
+        return nullptr;
+    }
+};
+
+class SVGPackageTurboModuleFactoryDelegate : public TurboModuleFactoryDelegate {
+public:
+    SharedTurboModule createTurboModule(Context ctx, const std::string &name) const override {
+        if (name == "RNSVGSvgViewModule") {
+            return std::make_shared<RNSVGSvgViewModule>(ctx, name);
+        }
         return nullptr;
     }
 };
@@ -109,6 +168,10 @@ public:
         return std::make_shared<SVGPackageComponentInstanceFactoryDelegate>();
     }
 
+    std::unique_ptr<TurboModuleFactoryDelegate> createTurboModuleFactoryDelegate() override {
+        return std::make_unique<SVGPackageTurboModuleFactoryDelegate>();
+    }
+
     std::vector<facebook::react::ComponentDescriptorProvider> createComponentDescriptorProviders() override;
 
     ComponentNapiBinderByString createComponentNapiBinderByName() override;
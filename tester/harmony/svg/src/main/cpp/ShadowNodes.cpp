@@ -20,6 +20,7 @@ extern const char RNSVGDefsComponentName[] = "RNSVGDefs";
 extern const char RNSVGEllipseComponentName[] = "RNSVGEllipse";
 extern const char RNSVGForeignObjectComponentName[] = "RNSVGForeignObject";
 extern const char RNSVGGroupComponentName[] = "RNSVGGroup";
+extern const char RNSVGImageComponentName[] = "RNSVGImage";
 extern const char RNSVGSvgViewComponentName[] = "RNSVGSvgView";
 extern const char RNSVGLinearGradientComponentName[] = "RNSVGLinearGradient";
 extern const char RNSVGLineComponentName[] = "RNSVGLine";
@@ -34,6 +35,14 @@ extern const char RNSVGTextComponentName[] = "RNSVGText";
 extern const char RNSVGTextPathComponentName[] = "RNSVGTextPath";
 extern const char RNSVGTSpanComponentName[] = "RNSVGTSpan";
 extern const char RNSVGUseComponentName[] = "RNSVGUse";
+extern const char RNSVGAnimateComponentName[] = "RNSVGAnimate";
+extern const char RNSVGFilterComponentName[] = "RNSVGFilter";
+extern const char RNSVGFeGaussianBlurComponentName[] = "RNSVGFeGaussianBlur";
+extern const char RNSVGFeOffsetComponentName[] = "RNSVGFeOffset";
+extern const char RNSVGFeFloodComponentName[] = "RNSVGFeFlood";
+extern const char RNSVGFeBlendComponentName[] = "RNSVGFeBlend";
+extern const char RNSVGFeCompositeComponentName[] = "RNSVGFeComposite";
+extern const char RNSVGFeColorMatrixComponentName[] = "RNSVGFeColorMatrix";
 
 } // namespace react
 } // namespace facebook
@@ -96,6 +96,17 @@ using RNSVGGroupShadowNode = ConcreteViewShadowNode<
     RNSVGGroupEventEmitter,
     RNSVGGroupState>;
 
+JSI_EXPORT extern const char RNSVGImageComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGImage> component.
+ */
+using RNSVGImageShadowNode = ConcreteViewShadowNode<
+    RNSVGImageComponentName,
+    RNSVGImageProps,
+    RNSVGImageEventEmitter,
+    RNSVGImageState>;
+
 JSI_EXPORT extern const char RNSVGSvgViewComponentName[];
 
 /*
@@ -250,5 +261,93 @@ using RNSVGUseShadowNode = ConcreteViewShadowNode<
     RNSVGUseEventEmitter,
     RNSVGUseState>;
 
+JSI_EXPORT extern const char RNSVGAnimateComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGAnimate> component.
+ */
+using RNSVGAnimateShadowNode = ConcreteViewShadowNode<
+    RNSVGAnimateComponentName,
+    RNSVGAnimateProps,
+    RNSVGAnimateEventEmitter,
+    RNSVGAnimateState>;
+
+JSI_EXPORT extern const char RNSVGFilterComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFilter> component.
+ */
+using RNSVGFilterShadowNode = ConcreteViewShadowNode<
+    RNSVGFilterComponentName,
+    RNSVGFilterProps,
+    RNSVGFilterEventEmitter,
+    RNSVGFilterState>;
+
+JSI_EXPORT extern const char RNSVGFeGaussianBlurComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeGaussianBlur> component.
+ */
+using RNSVGFeGaussianBlurShadowNode = ConcreteViewShadowNode<
+    RNSVGFeGaussianBlurComponentName,
+    RNSVGFeGaussianBlurProps,
+    RNSVGFeGaussianBlurEventEmitter,
+    RNSVGFeGaussianBlurState>;
+
+JSI_EXPORT extern const char RNSVGFeOffsetComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeOffset> component.
+ */
+using RNSVGFeOffsetShadowNode = ConcreteViewShadowNode<
+    RNSVGFeOffsetComponentName,
+    RNSVGFeOffsetProps,
+    RNSVGFeOffsetEventEmitter,
+    RNSVGFeOffsetState>;
+
+JSI_EXPORT extern const char RNSVGFeFloodComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeFlood> component.
+ */
+using RNSVGFeFloodShadowNode = ConcreteViewShadowNode<
+    RNSVGFeFloodComponentName,
+    RNSVGFeFloodProps,
+    RNSVGFeFloodEventEmitter,
+    RNSVGFeFloodState>;
+
+JSI_EXPORT extern const char RNSVGFeBlendComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeBlend> component.
+ */
+using RNSVGFeBlendShadowNode = ConcreteViewShadowNode<
+    RNSVGFeBlendComponentName,
+    RNSVGFeBlendProps,
+    RNSVGFeBlendEventEmitter,
+    RNSVGFeBlendState>;
+
+JSI_EXPORT extern const char RNSVGFeCompositeComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeComposite> component.
+ */
+using RNSVGFeCompositeShadowNode = ConcreteViewShadowNode<
+    RNSVGFeCompositeComponentName,
+    RNSVGFeCompositeProps,
+    RNSVGFeCompositeEventEmitter,
+    RNSVGFeCompositeState>;
+
+JSI_EXPORT extern const char RNSVGFeColorMatrixComponentName[];
+
+/*
+ * `ShadowNode` for <RNSVGFeColorMatrix> component.
+ */
+using RNSVGFeColorMatrixShadowNode = ConcreteViewShadowNode<
+    RNSVGFeColorMatrixComponentName,
+    RNSVGFeColorMatrixProps,
+    RNSVGFeColorMatrixEventEmitter,
+    RNSVGFeColorMatrixState>;
+
 } // namespace react
 } // namespace facebook
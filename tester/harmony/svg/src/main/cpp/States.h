@@ -122,6 +122,21 @@ public:
 #endif
 };
 
+class RNSVGImageState {
+public:
+  RNSVGImageState() = default;
+
+#ifdef ANDROID
+  RNSVGImageState(RNSVGImageState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
 class RNSVGSvgViewState {
 public:
   RNSVGSvgViewState() = default;
@@ -332,5 +347,125 @@ public:
 #endif
 };
 
+class RNSVGAnimateState {
+public:
+  RNSVGAnimateState() = default;
+
+#ifdef ANDROID
+  RNSVGAnimateState(RNSVGAnimateState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFilterState {
+public:
+  RNSVGFilterState() = default;
+
+#ifdef ANDROID
+  RNSVGFilterState(RNSVGFilterState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeGaussianBlurState {
+public:
+  RNSVGFeGaussianBlurState() = default;
+
+#ifdef ANDROID
+  RNSVGFeGaussianBlurState(RNSVGFeGaussianBlurState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeOffsetState {
+public:
+  RNSVGFeOffsetState() = default;
+
+#ifdef ANDROID
+  RNSVGFeOffsetState(RNSVGFeOffsetState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeFloodState {
+public:
+  RNSVGFeFloodState() = default;
+
+#ifdef ANDROID
+  RNSVGFeFloodState(RNSVGFeFloodState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeBlendState {
+public:
+  RNSVGFeBlendState() = default;
+
+#ifdef ANDROID
+  RNSVGFeBlendState(RNSVGFeBlendState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeCompositeState {
+public:
+  RNSVGFeCompositeState() = default;
+
+#ifdef ANDROID
+  RNSVGFeCompositeState(RNSVGFeCompositeState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
+class RNSVGFeColorMatrixState {
+public:
+  RNSVGFeColorMatrixState() = default;
+
+#ifdef ANDROID
+  RNSVGFeColorMatrixState(RNSVGFeColorMatrixState const &previousState, folly::dynamic data){};
+  folly::dynamic getDynamic() const {
+    return {};
+  };
+  MapBuffer getMapBuffer() const {
+    return MapBufferBuilder::EMPTY();
+  };
+#endif
+};
+
 } // namespace react
 } // namespace facebook
\ No newline at end of file
@@ -0,0 +1,495 @@
+#include "SvgAnimate.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include "properties/SvgDomType.h"
+#include "utils/StringUtils.h"
+
+namespace rnoh {
+
+namespace {
+const char INDEFINITE[] = "indefinite";
+const std::string TRANSFORM_ATTR = DOM_SVG_SRC_TRANSFORM;
+
+// SMIL clock value in ms: "2s", "250ms", "1.5min", "1h", "00:01:30.5", a bare
+// number is seconds. -1 for indefinite and for event based values such as
+// "click", which nothing triggers here.
+int32_t ParseClock(const std::string& value)
+{
+    const auto text = StringUtils::TrimStr(value.substr(0, value.find(';')));
+    if (text == INDEFINITE) {
+        return -1;
+    }
+    if (text.find(':') != std::string::npos) {
+        std::vector<double> parts;
+        StringUtils::StringSplitter(text, ':', parts);
+        double seconds = 0.0;
+        for (double part : parts) {
+            seconds = seconds * 60.0 + part;
+        }
+        return static_cast<int32_t>(std::lround(seconds * 1000.0));
+    }
+    char* end = nullptr;
+    const double number = std::strtod(text.c_str(), &end);
+    if (end == text.c_str()) {
+        return -1;
+    }
+    const std::string unit(end);
+    const double scale = unit == "ms" ? 1.0 : unit == "min" ? 60000.0 : unit == "h" ? 3600000.0 : 1000.0;
+    return static_cast<int32_t>(std::lround(number * scale));
+}
+
+void SplitList(const std::string& value, std::vector<std::string>& out)
+{
+    StringUtils::StringSplitter(value, ';', out);
+    for (auto& item : out) {
+        item = StringUtils::TrimStr(item);
+    }
+}
+
+std::vector<double> ParseNumbers(const std::string& value)
+{
+    std::vector<float> numbers;
+    StringUtils::ParseStringToArray(value, numbers);
+    return {numbers.begin(), numbers.end()};
+}
+
+double Lerp(double from, double to, double t)
+{
+    return from + (to - from) * t;
+}
+
+// y of the unit cubic bezier (0,0) (x1,y1) (x2,y2) (1,1) where its x is t
+double SplineEase(const std::vector<double>& spline, double t)
+{
+    auto bezier = [](double p1, double p2, double s) {
+        const double inverse = 1.0 - s;
+        return 3.0 * inverse * inverse * s * p1 + 3.0 * inverse * s * s * p2 + s * s * s;
+    };
+    // x is monotonic in s for control points within [0, 1]
+    double low = 0.0;
+    double high = 1.0;
+    double s = t;
+    for (int i = 0; i < 24; ++i) {
+        if (bezier(spline[0], spline[2], s) < t) {
+            low = s;
+        } else {
+            high = s;
+        }
+        s = (low + high) * 0.5;
+    }
+    return bezier(spline[1], spline[3], s);
+}
+
+double Distance(const std::vector<double>& from, const std::vector<double>& to)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < std::min(from.size(), to.size()); ++i) {
+        sum += (to[i] - from[i]) * (to[i] - from[i]);
+    }
+    return std::sqrt(sum);
+}
+
+std::vector<double> ColorChannels(const Color& color)
+{
+    return {static_cast<double>(color.GetAlpha()), static_cast<double>(color.GetRed()),
+            static_cast<double>(color.GetGreen()), static_cast<double>(color.GetBlue())};
+}
+} // namespace
+
+SvgAnimate::SvgAnimate(SvgAnimateType type) : type_(type)
+{
+    drawTraversed_ = false;
+}
+
+SvgAnimate::~SvgAnimate()
+{
+    if (auto scheduler = scheduler_.lock()) {
+        scheduler->RemoveAnimation(this);
+    }
+}
+
+void SvgAnimate::OnSetContext()
+{
+    if (auto scheduler = scheduler_.lock()) {
+        scheduler->RemoveAnimation(this);
+    }
+    scheduler_.reset();
+    if (context_) {
+        context_->AddAnimation(this);
+        scheduler_ = context_;
+    }
+}
+
+void SvgAnimate::SetType(SvgAnimateType type)
+{
+    if (type_ != type) {
+        type_ = type;
+        compiled_ = false;
+        // the base value belongs to the attribute the old kind targeted
+        target_ = nullptr;
+    }
+}
+
+bool SvgAnimate::ParseAndSetSpecializedAttr(const std::string& name, const std::string& value)
+{
+    // SVG spells these in camelCase, the names are kept lowercase
+    std::string key = name;
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    if (key == DOM_SVG_ANIMATION_ATTRIBUTE_NAME) {
+        attr_.attributeName = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_BEGIN) {
+        attr_.begin = ParseClock(value);
+    } else if (key == DOM_SVG_ANIMATION_DUR) {
+        attr_.dur = ParseClock(value);
+    } else if (key == DOM_SVG_ANIMATION_END) {
+        attr_.end = ParseClock(value);
+    } else if (key == DOM_SVG_ANIMATION_REPEAT_COUNT) {
+        attr_.repeatCount = StringUtils::TrimStr(value) == INDEFINITE
+                                ? -1
+                                : static_cast<int32_t>(std::lround(SvgAttributesParser::ParseDouble(value)));
+    } else if (key == DOM_SVG_ANIMATION_FILL) {
+        attr_.fillMode = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_CALC_MODE) {
+        attr_.calcMode = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_VALUES) {
+        SplitList(value, attr_.values);
+    } else if (key == DOM_SVG_ANIMATION_KEY_TIMES) {
+        StringUtils::StringSplitter(value, ';', attr_.keyTimes);
+    } else if (key == DOM_SVG_ANIMATION_KEY_SPLINES) {
+        SplitList(value, attr_.keySplines);
+    } else if (key == DOM_SVG_ANIMATION_KEY_POINTS) {
+        SplitList(value, attr_.keyPoints);
+    } else if (key == DOM_SVG_ANIMATION_FROM) {
+        attr_.from = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_TO) {
+        attr_.to = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_PATH) {
+        attr_.path = value;
+    } else if (key == DOM_SVG_ANIMATION_ROTATE) {
+        attr_.rotate = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_ANIMATION_TYPE) {
+        attr_.transformType = StringUtils::TrimStr(value);
+    } else if (key == DOM_SVG_HREF || key == DOM_SVG_XLINK_HREF) {
+        const auto id = StringUtils::TrimStr(value);
+        SetHref(!id.empty() && id[0] == '#' ? id.substr(1) : id);
+        target_ = nullptr;
+    } else {
+        return false;
+    }
+    compiled_ = false;
+    return true;
+}
+
+const std::string& SvgAnimate::GetTargetAttr() const
+{
+    return type_ == SvgAnimateType::ANIMATE_TRANSFORM || type_ == SvgAnimateType::ANIMATE_MOTION
+               ? TRANSFORM_ATTR
+               : attr_.attributeName;
+}
+
+void SvgAnimate::Compile(const SvgNode& target)
+{
+    compiled_ = true;
+    numbers_.clear();
+    colors_.clear();
+    texts_.clear();
+    motionPath_.Clear();
+    lastText_ = SIZE_MAX;
+
+    std::vector<std::string> sources = attr_.values;
+    // a to-only animation runs from the base value
+    const bool fromBase = sources.empty() && attr_.from.empty() && type_ != SvgAnimateType::SET;
+    if (sources.empty()) {
+        if (!attr_.from.empty() && type_ != SvgAnimateType::SET) {
+            sources.emplace_back(attr_.from);
+        }
+        if (!attr_.to.empty()) {
+            sources.emplace_back(attr_.to);
+        }
+    }
+
+    if (type_ == SvgAnimateType::ANIMATE_MOTION && !attr_.path.empty()) {
+        PathData data;
+        ParsePathData(attr_.path, data);
+        BuildArcLengthTable(data, motionPath_);
+        // keyframes become fractions of the path length
+        sources = attr_.keyPoints.empty() ? std::vector<std::string>{"0", "1"} : attr_.keyPoints;
+    }
+
+    SvgAnimatedValue probe;
+    const bool typed = target.GetAnimatedAttr(attr_.attributeName, probe);
+    if (type_ == SvgAnimateType::ANIMATE_TRANSFORM || type_ == SvgAnimateType::ANIMATE_MOTION) {
+        kind_ = ValueKind::NUMBERS;
+        for (const auto& source : sources) {
+            numbers_.emplace_back(ParseNumbers(source));
+        }
+    } else if (typed && probe.kind == SvgAnimatedValue::Kind::COLOR) {
+        kind_ = ValueKind::COLOR;
+        if (fromBase && hasBase_) {
+            colors_.emplace_back(base_.color);
+        }
+        for (const auto& source : sources) {
+            colors_.emplace_back(SvgAttributesParser::GetColor(source));
+        }
+    } else if (typed && probe.kind == SvgAnimatedValue::Kind::NUMBER) {
+        kind_ = ValueKind::NUMBERS;
+        if (fromBase && hasBase_) {
+            numbers_.push_back({base_.number});
+        }
+        for (const auto& source : sources) {
+            numbers_.push_back({SvgAttributesParser::ParseDouble(source)});
+        }
+    } else {
+        kind_ = ValueKind::TEXT;
+        texts_ = sources;
+    }
+    CompileTimes(std::max({numbers_.size(), colors_.size(), texts_.size()}));
+}
+
+void SvgAnimate::CompileTimes(size_t count)
+{
+    const auto& calcMode = attr_.calcMode;
+    const bool paced = calcMode == "paced" || (calcMode.empty() && type_ == SvgAnimateType::ANIMATE_MOTION);
+    discrete_ = calcMode == "discrete" || type_ == SvgAnimateType::SET || kind_ == ValueKind::TEXT;
+    times_.clear();
+    splines_.clear();
+    if (count == 0) {
+        return;
+    }
+    if (paced && !discrete_ && count > 1) {
+        // keyframes spaced by the distance between their values
+        times_.push_back(0.0);
+        for (size_t i = 1; i < count; ++i) {
+            const double step = kind_ == ValueKind::COLOR
+                                    ? Distance(ColorChannels(colors_[i - 1]), ColorChannels(colors_[i]))
+                                    : Distance(numbers_[i - 1], numbers_[i]);
+            times_.push_back(times_.back() + step);
+        }
+        if (times_.back() > 0.0) {
+            const double total = times_.back();
+            for (auto& time : times_) {
+                time /= total;
+            }
+            return;
+        }
+        times_.clear();
+    }
+    if (!paced && attr_.keyTimes.size() == count) {
+        times_ = attr_.keyTimes;
+    } else {
+        const double steps = discrete_ ? count : std::max<size_t>(count - 1, 1);
+        for (size_t i = 0; i < count; ++i) {
+            times_.push_back(i / steps);
+        }
+    }
+    if (calcMode == "spline" && !discrete_ && attr_.keySplines.size() + 1 == count) {
+        for (const auto& source : attr_.keySplines) {
+            auto spline = ParseNumbers(source);
+            if (spline.size() != 4) {
+                splines_.clear();
+                break;
+            }
+            splines_.emplace_back(std::move(spline));
+        }
+    }
+}
+
+double SvgAnimate::GetActiveDuration() const
+{
+    double active = -1.0;
+    if (attr_.dur > 0 && attr_.repeatCount >= 0) {
+        active = static_cast<double>(attr_.dur) * std::max(attr_.repeatCount, 1);
+    }
+    // end is unset while 0
+    if (attr_.end > 0) {
+        const double untilEnd = std::max(attr_.end - attr_.begin, 0);
+        active = active < 0.0 ? untilEnd : std::min(active, untilEnd);
+    }
+    return active;
+}
+
+void SvgAnimate::Locate(double progress, size_t& index, double& t) const
+{
+    const size_t count = times_.size();
+    index = 0;
+    t = 0.0;
+    if (count < 2) {
+        return;
+    }
+    const auto upper = std::upper_bound(times_.begin(), times_.end(), progress);
+    const size_t last = static_cast<size_t>(std::max<ptrdiff_t>(upper - times_.begin() - 1, 0));
+    if (discrete_) {
+        index = std::min(last, count - 1);
+        return;
+    }
+    index = std::min(last, count - 2);
+    const double span = times_[index + 1] - times_[index];
+    t = span > 0.0 ? std::clamp((progress - times_[index]) / span, 0.0, 1.0) : 1.0;
+    if (!splines_.empty()) {
+        t = SplineEase(splines_[index], t);
+    }
+}
+
+AffineTransform SvgAnimate::BuildTransform(const std::vector<double>& numbers) const
+{
+    if (numbers.empty()) {
+        return {};
+    }
+    const auto& type = attr_.transformType;
+    if (type == "scale") {
+        return AffineTransform::Scale(numbers[0], numbers.size() > 1 ? numbers[1] : numbers[0]);
+    }
+    if (type == "rotate") {
+        const double cx = numbers.size() > 2 ? numbers[1] : 0.0;
+        const double cy = numbers.size() > 2 ? numbers[2] : 0.0;
+        return AffineTransform::Translate(cx, cy) * AffineTransform::Rotate(numbers[0]) *
+               AffineTransform::Translate(-cx, -cy);
+    }
+    if (type == "skewX") {
+        return AffineTransform::Skew(numbers[0], 0.0);
+    }
+    if (type == "skewY") {
+        return AffineTransform::Skew(0.0, numbers[0]);
+    }
+    return AffineTransform::Translate(numbers[0], numbers.size() > 1 ? numbers[1] : 0.0);
+}
+
+void SvgAnimate::Apply(SvgNode& target, double progress)
+{
+    size_t index;
+    double t;
+    Locate(progress, index, t);
+    if (type_ == SvgAnimateType::ANIMATE_MOTION) {
+        ApplyMotion(target, index, t);
+        return;
+    }
+    const size_t next = discrete_ ? index : std::min(index + 1, times_.size() - 1);
+    SvgAnimatedValue value;
+    switch (kind_) {
+        case ValueKind::TEXT:
+            // reparsed only when the keyframe changes
+            if (index != lastText_) {
+                lastText_ = index;
+                target.SetAttr(attr_.attributeName, texts_[index]);
+            }
+            return;
+        case ValueKind::COLOR: {
+            const auto& from = colors_[index];
+            const auto& to = colors_[next];
+            auto channel = [t](uint8_t a, uint8_t b) { return static_cast<uint8_t>(std::lround(Lerp(a, b, t))); };
+            value.kind = SvgAnimatedValue::Kind::COLOR;
+            value.color = Color::FromARGB(channel(from.GetAlpha(), to.GetAlpha()), channel(from.GetRed(), to.GetRed()),
+                                          channel(from.GetGreen(), to.GetGreen()),
+                                          channel(from.GetBlue(), to.GetBlue()));
+            break;
+        }
+        case ValueKind::NUMBERS: {
+            const auto& from = numbers_[index];
+            const auto& to = numbers_[next];
+            std::vector<double> numbers(std::min(from.size(), to.size()));
+            for (size_t i = 0; i < numbers.size(); ++i) {
+                numbers[i] = Lerp(from[i], to[i], t);
+            }
+            if (type_ == SvgAnimateType::ANIMATE_TRANSFORM) {
+                // built in user units, transforms keep e/f in px
+                value.kind = SvgAnimatedValue::Kind::TRANSFORM;
+                value.transform = BuildTransform(numbers);
+                value.transform.e = vpToPx(value.transform.e);
+                value.transform.f = vpToPx(value.transform.f);
+            } else if (!numbers.empty()) {
+                value.number = numbers[0];
+            }
+            break;
+        }
+    }
+    target.SetAnimatedAttr(GetTargetAttr(), value);
+}
+
+void SvgAnimate::ApplyMotion(SvgNode& target, size_t index, double t)
+{
+    const auto& from = numbers_[index];
+    const auto& to = numbers_[discrete_ ? index : std::min(index + 1, numbers_.size() - 1)];
+    PathPoint point{0.0f, 0.0f};
+    float angle = 0.0f;
+    if (!motionPath_.lengths.empty()) {
+        const double fraction = from.empty() || to.empty() ? 0.0 : Lerp(from[0], to[0], t);
+        SampleArcLength(motionPath_, static_cast<float>(std::clamp(fraction, 0.0, 1.0) * motionPath_.Total()), point,
+                        angle);
+    } else if (from.size() >= 2 && to.size() >= 2) {
+        point = {static_cast<float>(Lerp(from[0], to[0], t)), static_cast<float>(Lerp(from[1], to[1], t))};
+        angle = static_cast<float>(std::atan2(to[1] - from[1], to[0] - from[0]) * 180.0 / M_PI);
+    }
+    double rotation = 0.0;
+    if (attr_.rotate == "auto") {
+        rotation = angle;
+    } else if (attr_.rotate == "auto-reverse") {
+        rotation = angle + 180.0;
+    } else if (!attr_.rotate.empty()) {
+        rotation = SvgAttributesParser::ParseDouble(attr_.rotate);
+    }
+    auto motion = AffineTransform::Translate(vpToPx(point.x), vpToPx(point.y)) * AffineTransform::Rotate(rotation);
+    // the motion applies on top of the element's own transform
+    SvgAnimatedValue value;
+    value.kind = SvgAnimatedValue::Kind::TRANSFORM;
+    value.transform = hasBase_ ? motion * base_.transform : motion;
+    target.SetAnimatedAttr(TRANSFORM_ATTR, value);
+}
+
+void SvgAnimate::Restore(SvgNode& target)
+{
+    // text keyframes have no typed base to go back to and keep their value
+    if (hasBase_ && kind_ != ValueKind::TEXT) {
+        target.SetAnimatedAttr(GetTargetAttr(), base_);
+    }
+}
+
+bool SvgAnimate::Tick(double ms)
+{
+    SvgNode* target = parent_;
+    if (attributes_.href != SVG_ID_NONE) {
+        target = context_ ? context_->GetSvgNodeByHandle(attributes_.href) : nullptr;
+    }
+    if (!target || attr_.begin < 0) {
+        return false;
+    }
+    if (target != target_) {
+        target_ = target;
+        hasBase_ = false;
+        finished_ = false;
+        compiled_ = false;
+    }
+    const double local = ms - attr_.begin;
+    if (local < 0.0) {
+        return true;
+    }
+    if (!hasBase_) {
+        hasBase_ = target->GetAnimatedAttr(GetTargetAttr(), base_);
+    }
+    if (!compiled_) {
+        Compile(*target);
+    }
+    if (times_.empty()) {
+        return false;
+    }
+    const double active = GetActiveDuration();
+    if (active >= 0.0 && local >= active) {
+        if (!finished_) {
+            finished_ = true;
+            if (attr_.fillMode == "freeze") {
+                // the value at the end of the last, possibly partial, iteration
+                const double rest = attr_.dur > 0 ? std::fmod(active, attr_.dur) : 0.0;
+                Apply(*target, attr_.dur > 0 && rest == 0.0 ? 1.0 : rest / std::max(attr_.dur, 1));
+            } else {
+                Restore(*target);
+            }
+        }
+        return false;
+    }
+    finished_ = false;
+    Apply(*target, attr_.dur > 0 ? std::fmod(local, attr_.dur) / attr_.dur : 0.0);
+    return true;
+}
+
+} // namespace rnoh
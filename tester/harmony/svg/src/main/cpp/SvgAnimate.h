@@ -0,0 +1,85 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "SvgNode.h"
+#include "utils/PathGeometry.h"
+#include "utils/SvgAttributesParser.h"
+
+namespace rnoh {
+
+enum class SvgAnimateType {
+    ANIMATE,
+    SET,
+    ANIMATE_TRANSFORM,
+    ANIMATE_MOTION,
+};
+
+// <animate>, <set>, <animateTransform> and <animateMotion>. Draws nothing;
+// the document ticks it every frame and it writes the value for that moment
+// into its target, the href'd element or its parent.
+class SvgAnimate : public SvgNode {
+public:
+    explicit SvgAnimate(SvgAnimateType type);
+    ~SvgAnimate() override;
+
+    // The element kind, settable after creation as the component instance
+    // learns it from props.
+    void SetType(SvgAnimateType type);
+
+    bool ParseAndSetSpecializedAttr(const std::string& name, const std::string& value) override;
+
+    // Applies the value at ms on the document timeline. False once the
+    // animation is over and needs no more frames.
+    bool Tick(double ms);
+
+protected:
+    void OnSetContext() override;
+
+private:
+    enum class ValueKind {
+        NUMBERS,
+        COLOR,
+        TEXT, // applied discretely through SetAttr
+    };
+
+    // parses the keyframes against what the target animates
+    void Compile(const SvgNode& target);
+    void CompileTimes(size_t count);
+    // Active duration in ms, negative for indefinite.
+    double GetActiveDuration() const;
+    // Keyframe segment and the progress through it at simple time progress.
+    void Locate(double progress, size_t& index, double& t) const;
+    void Apply(SvgNode& target, double progress);
+    void ApplyMotion(SvgNode& target, size_t index, double t);
+    AffineTransform BuildTransform(const std::vector<double>& numbers) const;
+    void Restore(SvgNode& target);
+
+    const std::string& GetTargetAttr() const;
+
+    SvgAnimateType type_;
+    SvgAnimateAttribute attr_;
+    std::weak_ptr<SvgContext> scheduler_;
+
+    bool compiled_ = false;
+    ValueKind kind_ = ValueKind::NUMBERS;
+    std::vector<std::vector<double>> numbers_;
+    std::vector<Color> colors_;
+    std::vector<std::string> texts_;
+    // one per keyframe, derived when keyTimes are absent or calcMode is paced
+    std::vector<double> times_;
+    bool discrete_ = false;
+    // x1 y1 x2 y2 per segment when calcMode is spline
+    std::vector<std::vector<double>> splines_;
+    // animateMotion along path
+    ArcLengthTable motionPath_;
+
+    // target the base value was captured from, compared by address
+    const SvgNode* target_ = nullptr;
+    SvgAnimatedValue base_;
+    bool hasBase_ = false;
+    bool finished_ = false;
+    size_t lastText_ = SIZE_MAX;
+};
+
+} // namespace rnoh
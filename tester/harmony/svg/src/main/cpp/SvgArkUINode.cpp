@@ -8,6 +8,8 @@
 #include <native_drawing/drawing_pen.h>
 #include <native_drawing/drawing_types.h>
 #include "SvgArkUINode.h"
+#include "SvgSvg.h"
+#include "utils/Utils.h"
 #include <sstream>
 
 namespace rnoh {
@@ -59,13 +61,28 @@ SvgArkUINode::~SvgArkUINode() {
     delete userCallback_;
 }
 
+void SvgArkUINode::RequestRender() {
+    nativeModule_->markDirty(m_nodeHandle, NODE_NEED_RENDER);
+}
+
 void SvgArkUINode::OnDraw(ArkUI_NodeCustomEvent *event) {
     //
     auto *drawContext = OH_ArkUI_NodeCustomEvent_GetDrawContextInDraw(event);
     auto *drawingHandle = reinterpret_cast<OH_Drawing_Canvas *>(OH_ArkUI_DrawContext_GetCanvas(drawContext));
     LOG(INFO) << "[svg] <SVGArkUINode> CanvasGetHeight: " << OH_Drawing_CanvasGetHeight(drawingHandle) / 3.25010318;
     LOG(INFO) << "[svg] <SVGArkUINode> CanvasGetWidth: " << OH_Drawing_CanvasGetWidth(drawingHandle) / 3.25010318;
+    auto svg = std::dynamic_pointer_cast<SvgSvg>(root_);
+    if (svg) {
+        auto size = OH_ArkUI_DrawContext_GetSize(drawContext);
+        svg->SetLayoutSize(Size(size.width, size.height));
+    }
+    // animations write into the tree ahead of the frame they show up in
+    const bool animating = svg && svg->TickAnimations(GetNanoseconds());
     root_->Draw(drawingHandle);
+    // the frame shown was older than the document, poll for the prepared one
+    if (animating || (svg && svg->NeedsRedraw())) {
+        nativeModule_->markDirty(m_nodeHandle, NODE_NEED_RENDER);
+    }
 }
 
 }; // namespace rnoh
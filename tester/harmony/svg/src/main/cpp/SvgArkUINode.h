@@ -27,6 +27,8 @@ public:
     {
         root_ = node;
     }
+    // Schedules a draw for the next frame, requests within a frame coalesce.
+    void RequestRender();
     void ResetNodeHandle() {
         
     }
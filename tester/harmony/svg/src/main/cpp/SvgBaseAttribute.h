@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Attribute.h"
+#include "SvgContext.h"
 #include "properties/SvgPaintState.h"
 #include <string>
 
@@ -19,8 +20,7 @@ struct SvgBaseAttribute : Attribute {
     std::string transformOrigin;
     std::string filterId;
     std::string maskId;
-    std::string href;
-    std::string id;
+    SvgIdHandle href = SVG_ID_NONE;
 //     ClipState clipState;
 
     void InheritFromUse(const SvgBaseAttribute& parent)
@@ -14,36 +14,41 @@
  */
 
 #include "SvgCircle.h"
+#include <native_drawing/drawing_rect.h>
+#include "properties/SvgDomType.h"
 
 namespace rnoh {
-void SvgCircle::OnDraw(OH_Drawing_Canvas *canvas) {
-    LOG(INFO) << "[SVGNode] OnCircle:";
-    auto brush = OH_Drawing_BrushCreate();
-
-    OH_Drawing_BrushSetColor(brush, colorFill);
-    OH_Drawing_BrushSetAlpha(brush, opacity);
+OH_Drawing_Path *SvgCircle::AsPath() const {
+    auto *rect = OH_Drawing_RectCreate(vpToPx(x - r), vpToPx(y - r), vpToPx(x + r), vpToPx(y + r));
+    OH_Drawing_PathAddOval(path_, rect, PATH_DIRECTION_CW);
+    OH_Drawing_RectDestroy(rect);
+    return path_;
+}
 
-    OH_Drawing_CanvasAttachBrush(canvas, brush);
-    auto point = OH_Drawing_PointCreate(vpToPx(x), vpToPx(y));
-    // 使用 props属性生成路径。
-    OH_Drawing_CanvasDrawCircle(canvas, point, vpToPx(r));
-    OH_Drawing_PointDestroy(point);
+bool SvgCircle::GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const {
+    if (name == DOM_SVG_CX) {
+        return GetAnimatedField(x, value);
+    }
+    if (name == DOM_SVG_CY) {
+        return GetAnimatedField(y, value);
+    }
+    if (name == DOM_SVG_R) {
+        return GetAnimatedField(r, value);
+    }
+    return SvgGraphic::GetAnimatedAttr(name, value);
 }
 
-//  OH_Drawing_Path* SvgCircle:: AsPath()  {
-//      auto path = OH_Drawing_PathCreate();
-//      // 使用 props属性生成路径。
-//      float width = width_;
-//      float height = height_;
-//      OH_Drawing_PathMoveTo(path, width / 4, height / 4);
-//      OH_Drawing_PathLineTo(path, width * 3 / 4, height / 4);
-//      OH_Drawing_PathLineTo(path, width * 3 / 4, height * 3 / 4);
-//      OH_Drawing_PathLineTo(path, width / 4, height * 3 / 4);
-//      OH_Drawing_PathLineTo(path, width / 4, height / 4);
-//
-//
-//      OH_Drawing_PathClose(path);
-//      return path;
-//  }
+bool SvgCircle::SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) {
+    if (name == DOM_SVG_CX) {
+        return SetAnimatedField(x, value);
+    }
+    if (name == DOM_SVG_CY) {
+        return SetAnimatedField(y, value);
+    }
+    if (name == DOM_SVG_R) {
+        return SetAnimatedField(r, value);
+    }
+    return SvgGraphic::SetAnimatedAttr(name, value);
+}
 
 } // namespace rnoh
@@ -29,10 +29,18 @@ public:
     float x;
     float y;
     float r;
-    float opacity;
-    uint32_t colorFill;
-    void OnDraw(OH_Drawing_Canvas *canvas) override;
-//     OH_Drawing_Path *AsPath() override;
+    bool GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const override;
+    bool SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) override;
+
+    OH_Drawing_Path *AsPath() const override;
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        for (float value : {x, y, r}) {
+            HashCombine(seed, value);
+        }
+        return SvgGraphic::HashContent(seed);
+    }
 
 private:
  
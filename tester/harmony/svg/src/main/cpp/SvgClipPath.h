@@ -0,0 +1,43 @@
+#pragma once
+
+#include <native_drawing/drawing_matrix.h>
+#include <native_drawing/drawing_path.h>
+#include "SvgQuote.h"
+
+namespace rnoh {
+
+// <clipPath>: never drawn, referencing nodes clip to the union of its
+// children's outlines, mapped by the clipPath's own transform.
+class SvgClipPath : public SvgQuote {
+ public:
+  SvgClipPath() = default;
+  ~SvgClipPath() override = default;
+
+  OH_Drawing_Path* CopyPath() override {
+    auto* path = OH_Drawing_PathCreate();
+    OH_Drawing_Matrix* matrix = nullptr;
+    for (const auto& child : children_) {
+      auto* childPath = child->CopyPath();
+      if (!childPath) {
+        continue;
+      }
+      const auto transform = transform_ * child->GetTransform();
+      if (!transform.IsIdentity()) {
+        if (!matrix) {
+          matrix = OH_Drawing_MatrixCreate();
+        }
+        OH_Drawing_MatrixSetMatrix(
+            matrix, transform.a, transform.c, transform.e, transform.b, transform.d, transform.f, 0, 0, 1);
+        OH_Drawing_PathTransform(childPath, matrix);
+      }
+      OH_Drawing_PathOp(path, childPath, PATH_OP_MODE_UNION);
+      OH_Drawing_PathDestroy(childPath);
+    }
+    if (matrix) {
+      OH_Drawing_MatrixDestroy(matrix);
+    }
+    return path;
+  }
+};
+
+} // namespace rnoh
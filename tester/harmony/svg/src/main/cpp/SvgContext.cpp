@@ -1,14 +1,86 @@
 
 #include "SvgNode.h"
+#include "SvgAnimate.h"
+#include <algorithm>
 
 namespace rnoh {
-std::shared_ptr<SvgNode> SvgContext::GetSvgNodeById(const std::string& id) const
+SvgIdHandle SvgContext::Intern(const std::string& id)
 {
-    auto item = idMapper_.find(id);
-    if (item != idMapper_.end()) {
+    if (id.empty()) {
+        return SVG_ID_NONE;
+    }
+    auto item = idHandles_.find(id);
+    if (item != idHandles_.end()) {
         return item->second;
     }
-    return nullptr;
+    auto handle = static_cast<SvgIdHandle>(idNames_.size());
+    idHandles_.emplace(id, handle);
+    idNames_.emplace_back(id);
+    nodesByHandle_.emplace_back(nullptr);
+    return handle;
+}
+
+void SvgContext::Push(SvgIdHandle handle, SvgNode* svgNode)
+{
+    if (handle == SVG_ID_NONE || handle >= nodesByHandle_.size()) {
+        return;
+    }
+    nodesByHandle_[handle] = svgNode;
+}
+
+void SvgContext::Remove(SvgIdHandle handle, const SvgNode* svgNode)
+{
+    if (handle < nodesByHandle_.size() && nodesByHandle_[handle] == svgNode) {
+        nodesByHandle_[handle] = nullptr;
+    }
+}
+
+void SvgContext::AddAnimation(SvgAnimate* animation)
+{
+    if (std::find(animations_.begin(), animations_.end(), animation) == animations_.end()) {
+        animations_.push_back(animation);
+    }
+    hasAnimations_.store(true, std::memory_order_release);
+}
+
+void SvgContext::RemoveAnimation(const SvgAnimate* animation)
+{
+    animations_.erase(std::remove(animations_.begin(), animations_.end(), animation), animations_.end());
+    hasAnimations_.store(!animations_.empty(), std::memory_order_release);
+}
+
+bool SvgContext::TickAnimations(uint64_t nowNs)
+{
+    if (animations_.empty()) {
+        return false;
+    }
+    if (timelineStart_ == 0) {
+        timelineStart_ = nowNs;
+    }
+    const double ms = (nowNs - timelineStart_) / 1e6;
+    bool running = false;
+    for (auto* animation : animations_) {
+        running |= animation->Tick(ms);
+    }
+    return running;
+}
+
+void SvgContext::RemoveTag(int32_t tag, const SvgNode* svgNode)
+{
+    auto item = nodesByTag_.find(tag);
+    if (item != nodesByTag_.end() && item->second == svgNode) {
+        nodesByTag_.erase(item);
+    }
+}
+
+std::shared_ptr<SvgNode> SvgContext::GetSvgNodeById(const std::string& id) const
+{
+    auto item = idHandles_.find(id);
+    if (item == idHandles_.end()) {
+        return nullptr;
+    }
+    auto* node = nodesByHandle_[item->second];
+    return node ? node->shared_from_this() : nullptr;
 }
 
 void SvgContext::PushStyle(const std::string& styleName, const std::pair<std::string, std::string>& attrPair)
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "properties/Rect.h"
 #include "properties/Size.h"
@@ -10,13 +14,55 @@
 namespace rnoh {
 using AttrMap = std::unordered_map<std::string, std::string>;
 using ClassStyleMap = std::unordered_map<std::string, AttrMap>;
+
+// Dense per-document handle of an element id, 0 means "no reference".
+using SvgIdHandle = uint32_t;
+constexpr SvgIdHandle SVG_ID_NONE = 0;
+
 class SvgNode;
+class SvgAnimate;
 class SvgContext {
  public:
+  SvgContext() : idNames_(1), nodesByHandle_(1, nullptr) {}
+
+  // Interns an element id. Handles are never recycled, so a handle stored on a
+  // node stays valid for the lifetime of the document.
+  SvgIdHandle Intern(const std::string& id);
+
+  const std::string& GetIdString(SvgIdHandle handle) const {
+    return handle < idNames_.size() ? idNames_[handle] : idNames_[SVG_ID_NONE];
+  }
+
+  void Push(SvgIdHandle handle, SvgNode* svgNode);
   void Push(const std::string& value, const std::shared_ptr<SvgNode>& svgNode) {
-    idMapper_.emplace(value, svgNode);
+    Push(Intern(value), svgNode.get());
   }
+  // Drops the registration only if it still points to svgNode.
+  void Remove(SvgIdHandle handle, const SvgNode* svgNode);
 
+  // Draw path lookup, a plain array index.
+  SvgNode* GetSvgNodeByHandle(SvgIdHandle handle) const {
+    return handle < nodesByHandle_.size() ? nodesByHandle_[handle] : nullptr;
+  }
+
+  // React tags of the component instances behind the nodes, for updates
+  // that address nodes directly instead of going through props.
+  void PushTag(int32_t tag, SvgNode* svgNode) { nodesByTag_[tag] = svgNode; }
+  void RemoveTag(int32_t tag, const SvgNode* svgNode);
+  SvgNode* GetSvgNodeByTag(int32_t tag) const {
+    auto item = nodesByTag_.find(tag);
+    return item == nodesByTag_.end() ? nullptr : item->second;
+  }
+
+  // Bumped whenever a node joins or leaves the tree, for caches of its shape.
+  void MarkStructureChanged() {
+    ++structureVersion_;
+  }
+  uint64_t GetStructureVersion() const {
+    return structureVersion_;
+  }
+
+  // String keyed lookup, kept for the JS facing APIs.
   std::shared_ptr<SvgNode> GetSvgNodeById(const std::string& id) const;
 
   void PushStyle(
@@ -25,12 +71,72 @@ class SvgContext {
 
   const AttrMap& GetAttrMap(const std::string& key) const;
 
-  void SetViewBox(const Rect& viewBox) { rootViewBox_ = viewBox; }
+  // true when the size percentages resolve against changed
+  bool SetViewBox(const Rect& viewBox) {
+    const bool resized = viewBox.Width() != rootViewBox_.Width() ||
+        viewBox.Height() != rootViewBox_.Height();
+    rootViewBox_ = viewBox;
+    return resized;
+  }
+  const Rect& GetRootViewBox() const { return rootViewBox_; }
+
+  // device pixels per unit of the root's user space, set when drawing starts
+  void SetDeviceScale(float scale) { deviceScale_ = scale; }
+  float GetDeviceScale() const { return deviceScale_; }
+
+  // Counts draws that left out content still loading, e.g. an image being
+  // decoded. Recordings made while it moved are not kept.
+  void MarkIncomplete() { ++incompleteDraws_; }
+  uint64_t GetIncompleteCount() const { return incompleteDraws_; }
+
+  // Held by whoever reads or mutates the document's nodes: the UI thread
+  // applying props and the worker preparing a frame.
+  std::mutex& GetTreeMutex() { return treeMutex_; }
+  // Taken by the UI thread. While it waits, a worker preparing a frame gives
+  // the frame up at the next node, so the wait is one node, not a frame.
+  std::unique_lock<std::mutex> LockTreePreempting() {
+    waitingLockers_.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock(treeMutex_);
+    waitingLockers_.fetch_sub(1, std::memory_order_relaxed);
+    return lock;
+  }
+  // Set by the worker, under the tree mutex, around a frame it may give up.
+  void SetPreemptible(bool preemptible) { preemptible_ = preemptible; }
+  // Polled by preemptible work between nodes.
+  bool ShouldYield() const {
+    return preemptible_ && waitingLockers_.load(std::memory_order_relaxed) > 0;
+  }
+
+  // Declarative animations of the document, registered by the animation
+  // nodes themselves while they are attached.
+  void AddAnimation(SvgAnimate* animation);
+  void RemoveAnimation(const SvgAnimate* animation);
+  // Evaluates every animation at nowNs, the timeline starts at the first
+  // tick. True while any of them needs more frames. Holds the tree mutex.
+  bool TickAnimations(uint64_t nowNs);
+  // Readable without the tree mutex, so documents that never animate do not
+  // wait on a worker holding it.
+  bool HasAnimations() const {
+    return hasAnimations_.load(std::memory_order_acquire);
+  }
 
  private:
-  std::unordered_map<std::string, std::shared_ptr<SvgNode>> idMapper_;
+  std::unordered_map<std::string, SvgIdHandle> idHandles_;
+  std::vector<std::string> idNames_;
+  // non-owning, nodes unregister themselves on destruction
+  std::vector<SvgNode*> nodesByHandle_;
+  std::unordered_map<int32_t, SvgNode*> nodesByTag_;
   ClassStyleMap styleMap_;
   Rect rootViewBox_;
   Size viewPort_;
+  float deviceScale_ = 1.0f;
+  uint64_t incompleteDraws_ = 0;
+  std::mutex treeMutex_;
+  std::atomic<int> waitingLockers_{0};
+  bool preemptible_ = false;
+  std::vector<SvgAnimate*> animations_;
+  std::atomic<bool> hasAnimations_{false};
+  uint64_t structureVersion_ = 1;
+  uint64_t timelineStart_ = 0;
 };
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
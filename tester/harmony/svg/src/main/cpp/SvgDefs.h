@@ -0,0 +1,27 @@
+#pragma once
+#include "SvgNode.h"
+
+namespace rnoh {
+
+// Holds referenced elements, its children are only drawn through a reference.
+class SvgDefs : public SvgNode {
+public:
+    SvgDefs() : SvgNode()
+    {
+        InitDefsFlag();
+    }
+    ~SvgDefs() override = default;
+
+protected:
+    bool HashContent(WideHash& seed) const override { return true; }
+
+    void InitDefsFlag()
+    {
+        hrefFill_ = false;
+        hrefRender_ = false;
+        inheritStyle_ = false;
+        drawTraversed_ = false;
+    }
+};
+
+} // namespace rnoh
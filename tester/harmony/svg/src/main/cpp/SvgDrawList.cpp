@@ -0,0 +1,119 @@
+#include "SvgDrawList.h"
+#include "SvgNode.h"
+
+namespace rnoh {
+
+void SvgDrawList::Build(SvgNode& root)
+{
+    records_.clear();
+    for (const auto& child : root.children_) {
+        if (child) {
+            Append(*child);
+        }
+    }
+    structureVersion_ = root.context_->GetStructureVersion();
+}
+
+void SvgDrawList::Append(SvgNode& node)
+{
+    const size_t index = records_.size();
+    records_.emplace_back();
+    records_[index].node = &node;
+    for (const auto& child : node.children_) {
+        if (child) {
+            Append(*child);
+        }
+    }
+    records_[index].end = static_cast<uint32_t>(records_.size());
+}
+
+void SvgDrawList::Refresh(SvgDrawRecord& record)
+{
+    auto& node = *record.node;
+    record.path = nullptr;
+    record.brush = nullptr;
+    record.pen = nullptr;
+    record.op = node.PrepareFlatDraw(record) ? record.op : SvgDrawOp::NODE;
+    if (record.op == SvgDrawOp::SHAPE) {
+        // a shape draws no children of its own, any that are drawn need Draw()
+        for (const auto& child : node.children_) {
+            if (child && child->drawTraversed_) {
+                record.op = SvgDrawOp::NODE;
+                break;
+            }
+        }
+    }
+    const auto& transform = node.transform_;
+    record.transformed = !transform.IsIdentity();
+    record.matrix = transform.IsTranslateOnly() ? nullptr : node.transformMatrix_;
+    record.translateX = static_cast<float>(transform.e);
+    record.translateY = static_cast<float>(transform.f);
+    record.generation = node.generation_;
+}
+
+void SvgDrawList::Draw(SvgNode& root, OH_Drawing_Canvas* canvas)
+{
+    if (!root.context_) {
+        return;
+    }
+    if (records_.empty() || structureVersion_ != root.context_->GetStructureVersion()) {
+        Build(root);
+    }
+    openGroups_.clear();
+    const auto count = static_cast<uint32_t>(records_.size());
+    for (uint32_t i = 0; i < count;) {
+        while (!openGroups_.empty() && openGroups_.back() <= i) {
+            OH_Drawing_CanvasRestore(canvas);
+            openGroups_.pop_back();
+        }
+        if (root.context_->ShouldYield()) {
+            break;
+        }
+        auto& record = records_[i];
+        if (!record.node->drawTraversed_) {
+            i = record.end;
+            continue;
+        }
+        if (record.generation != record.node->generation_) {
+            Refresh(record);
+        }
+        if (record.op == SvgDrawOp::NODE) {
+            record.node->Draw(canvas);
+            i = record.end;
+            continue;
+        }
+        const bool save = record.transformed || record.op == SvgDrawOp::GROUP;
+        if (save) {
+            OH_Drawing_CanvasSave(canvas);
+        }
+        if (record.matrix) {
+            OH_Drawing_CanvasConcatMatrix(canvas, record.matrix);
+        } else if (record.transformed) {
+            OH_Drawing_CanvasTranslate(canvas, record.translateX, record.translateY);
+        }
+        if (record.op == SvgDrawOp::GROUP) {
+            openGroups_.push_back(record.end);
+            ++i;
+            continue;
+        }
+        if (record.brush) {
+            OH_Drawing_CanvasAttachBrush(canvas, record.brush);
+            OH_Drawing_CanvasDrawPath(canvas, record.path);
+            OH_Drawing_CanvasDetachBrush(canvas);
+        }
+        if (record.pen) {
+            OH_Drawing_CanvasAttachPen(canvas, record.pen);
+            OH_Drawing_CanvasDrawPath(canvas, record.path);
+            OH_Drawing_CanvasDetachPen(canvas);
+        }
+        if (save) {
+            OH_Drawing_CanvasRestore(canvas);
+        }
+        i = record.end;
+    }
+    for (size_t open = openGroups_.size(); open > 0; --open) {
+        OH_Drawing_CanvasRestore(canvas);
+    }
+}
+
+} // namespace rnoh
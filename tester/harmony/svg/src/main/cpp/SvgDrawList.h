@@ -0,0 +1,64 @@
+#pragma once
+#include <native_drawing/drawing_brush.h>
+#include <native_drawing/drawing_canvas.h>
+#include <native_drawing/drawing_matrix.h>
+#include <native_drawing/drawing_path.h>
+#include <native_drawing/drawing_pen.h>
+#include <cstdint>
+#include <vector>
+
+namespace rnoh {
+
+class SvgNode;
+
+enum class SvgDrawOp : uint8_t {
+    // drawn through its virtual Draw(), the subtree is skipped
+    NODE,
+    // plain container: save, transform, children, restore
+    GROUP,
+    // fills and strokes path with brush and pen
+    SHAPE,
+};
+
+// One node of the flattened tree, in preorder.
+struct SvgDrawRecord {
+    SvgNode* node = nullptr;
+    // node generation the fields below were taken at
+    uint64_t generation = 0;
+    OH_Drawing_Path* path = nullptr;
+    // nullptr when nothing is filled
+    OH_Drawing_Brush* brush = nullptr;
+    OH_Drawing_Pen* pen = nullptr;
+    // nullptr when the transform is a translation or the identity
+    OH_Drawing_Matrix* matrix = nullptr;
+    float translateX = 0.0f;
+    float translateY = 0.0f;
+    // index past the last record of the subtree
+    uint32_t end = 0;
+    SvgDrawOp op = SvgDrawOp::NODE;
+    bool transformed = false;
+};
+
+// The children of a document in draw order as one contiguous array. It is
+// rebuilt only when the document's structure changes. A record is refreshed,
+// through a virtual call, only when its node changed; otherwise drawing is a
+// linear loop that paints plain groups and shapes straight from the cached
+// handles. Nodes with clips, masks, filters or their own drawing fall back
+// to Draw() for their subtree.
+class SvgDrawList {
+public:
+    // Draws the children of root, the caller holds the tree mutex.
+    void Draw(SvgNode& root, OH_Drawing_Canvas* canvas);
+
+private:
+    void Build(SvgNode& root);
+    void Append(SvgNode& node);
+    static void Refresh(SvgDrawRecord& record);
+
+    std::vector<SvgDrawRecord> records_;
+    uint64_t structureVersion_ = 0;
+    // ends of the groups currently saved, reused between draws
+    std::vector<uint32_t> openGroups_;
+};
+
+} // namespace rnoh
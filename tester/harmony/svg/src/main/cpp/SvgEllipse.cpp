@@ -12,3 +12,37 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
+#include "SvgEllipse.h"
+#include "properties/SvgDomType.h"
+
+namespace rnoh {
+
+namespace {
+const std::pair<const char *, SvgEllipse::Float SvgEllipse::*> ANIMATED_FIELDS[] = {
+    {DOM_SVG_CX, &SvgEllipse::cx},
+    {DOM_SVG_CY, &SvgEllipse::cy},
+    {DOM_SVG_RX, &SvgEllipse::rx},
+    {DOM_SVG_RY, &SvgEllipse::ry},
+};
+} // namespace
+
+bool SvgEllipse::GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return GetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::GetAnimatedAttr(name, value);
+}
+
+bool SvgEllipse::SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return SetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::SetAnimatedAttr(name, value);
+}
+
+} // namespace rnoh
@@ -21,11 +21,22 @@ public:
     uint32_t colorFill;
     uint32_t strokeColor;
     uint32_t strokeWith;
+    bool GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const override;
+    bool SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) override;
+
     OH_Drawing_Path *AsPath() const override {
         LOG(INFO) << "[SvgEllipse] AsPath";
         OH_Drawing_PathArcTo (path_, vpToPx(cx - rx), vpToPx(cy - ry), vpToPx(cx + rx), vpToPx(cy + ry), 0, 350);
         return path_;
     };
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        for (Float value : {cx, cy, rx, ry}) {
+            HashCombine(seed, value);
+        }
+        return SvgGraphic::HashContent(seed);
+    }
 };
 
 } // namespace rnoh
@@ -0,0 +1,51 @@
+#include "SvgFe.h"
+#include "properties/SvgDomType.h"
+#include "utils/StringUtils.h"
+
+namespace rnoh {
+
+SvgFeIn SvgFe::ParseFeIn(const std::string& value)
+{
+    static const std::pair<const char*, SvgFeInType> KEYWORDS[] = {
+        {"SourceGraphic", SvgFeInType::SOURCE_GRAPHIC},
+        {"SourceAlpha", SvgFeInType::SOURCE_ALPHA},
+        {"BackgroundImage", SvgFeInType::BACKGROUND_IMAGE},
+        {"BackgroundAlpha", SvgFeInType::BACKGROUND_ALPHA},
+        {"FillPaint", SvgFeInType::FILL_PAINT},
+        {"StrokePaint", SvgFeInType::STROKE_PAINT},
+    };
+    const auto name = StringUtils::TrimStr(value);
+    for (const auto& keyword : KEYWORDS) {
+        if (name == keyword.first) {
+            return {keyword.second, ""};
+        }
+    }
+    return {SvgFeInType::PRIMITIVE, name};
+}
+
+bool SvgFe::ParseAndSetSpecializedAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_FE_IN) {
+        feAttr_.in = ParseFeIn(value);
+    } else if (name == DOM_SVG_FE_RESULT) {
+        feAttr_.result = StringUtils::TrimStr(value);
+    } else if (name == DOM_SVG_X) {
+        feAttr_.x = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_Y) {
+        feAttr_.y = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_WIDTH) {
+        feAttr_.width = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_HEIGHT) {
+        feAttr_.height = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_FE_COLOR_INTERPOLATION_FILTERS) {
+        feAttr_.colorInterpolationType = value == "linearRGB" ? SvgColorInterpolationType::LINEAR_RGB
+                                         : value == "sRGB"    ? SvgColorInterpolationType::SRGB
+                                                              : SvgColorInterpolationType::AUTO;
+    } else if (!ParseFeAttr(name, value)) {
+        return false;
+    }
+    MarkDirty();
+    return true;
+}
+
+} // namespace rnoh
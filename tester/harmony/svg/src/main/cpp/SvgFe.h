@@ -0,0 +1,51 @@
+#pragma once
+#include "SvgNode.h"
+#include "utils/FilterGraph.h"
+#include "utils/SvgAttributesParser.h"
+
+namespace rnoh {
+
+// Base of the filter primitives, children of <filter>. Primitives are never
+// drawn on their own, SvgFilter runs them through its FilterGraph.
+class SvgFe : public SvgNode, public FilterEffect {
+public:
+    SvgFe()
+    {
+        drawTraversed_ = false;
+    }
+    ~SvgFe() override = default;
+
+    const SvgFeCommonAttribute& GetCommonAttr() const
+    {
+        return feAttr_;
+    }
+
+    void GetInputs(std::vector<SvgFeIn>& inputs) const override
+    {
+        inputs.push_back(feAttr_.in);
+    }
+    const std::string& GetResult() const override
+    {
+        return feAttr_.result;
+    }
+    SvgColorInterpolationType GetColorInterpolation() const override
+    {
+        return feAttr_.colorInterpolationType;
+    }
+
+    // Parses in, result, the subregion and color-interpolation-filters, then
+    // the attributes of the primitive through ParseFeAttr.
+    bool ParseAndSetSpecializedAttr(const std::string& name, const std::string& value) override;
+
+protected:
+    virtual bool ParseFeAttr(const std::string& name, const std::string& value)
+    {
+        return false;
+    }
+
+    static SvgFeIn ParseFeIn(const std::string& value);
+
+    SvgFeCommonAttribute feAttr_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,35 @@
+#include "SvgFeBlend.h"
+#include "properties/SvgDomType.h"
+#include "utils/LinearMap.h"
+#include "utils/Utils.h"
+
+namespace rnoh {
+
+void SvgFeBlend::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+                       const FilterUnits& units) const
+{
+    Blend(inputs[0], inputs[1], output, region, attr_.blendMode);
+}
+
+bool SvgFeBlend::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    static const LinearMapNode<SvgFeBlendMode> MODES[] = {
+        {"darken", SvgFeBlendMode::DARKEN},
+        {"lighten", SvgFeBlendMode::LIGHTEN},
+        {"multiply", SvgFeBlendMode::MULTIPLY},
+        {"normal", SvgFeBlendMode::NORMAL},
+        {"screen", SvgFeBlendMode::SCREEN},
+    };
+    if (name == DOM_SVG_FE_IN2) {
+        attr_.in2 = ParseFeIn(value);
+        return true;
+    }
+    if (name == DOM_SVG_FE_MODE) {
+        auto index = BinarySearchFindIndex(MODES, ArraySize(MODES), value.c_str());
+        attr_.blendMode = index < 0 ? SvgFeBlendMode::NORMAL : MODES[index].value;
+        return true;
+    }
+    return false;
+}
+
+} // namespace rnoh
@@ -0,0 +1,26 @@
+#pragma once
+#include "SvgFe.h"
+
+namespace rnoh {
+
+class SvgFeBlend : public SvgFe {
+public:
+    SvgFeBlend() = default;
+    ~SvgFeBlend() override = default;
+
+    void GetInputs(std::vector<SvgFeIn>& inputs) const override
+    {
+        inputs.push_back(feAttr_.in);
+        inputs.push_back(attr_.in2);
+    }
+    void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+               const FilterUnits& units) const override;
+
+protected:
+    bool ParseFeAttr(const std::string& name, const std::string& value) override;
+
+private:
+    SvgFeBlendAttribute attr_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,36 @@
+#include "SvgFeColorMatrix.h"
+#include "properties/SvgDomType.h"
+#include "utils/StringUtils.h"
+
+namespace rnoh {
+
+SvgFeColorMatrix::SvgFeColorMatrix()
+{
+    BuildColorMatrix(attr_.type, {}, matrix_);
+}
+
+void SvgFeColorMatrix::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output,
+                             const PixelRect& region, const FilterUnits& units) const
+{
+    ColorMatrix(inputs[0], output, region, matrix_);
+}
+
+bool SvgFeColorMatrix::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_FE_TYPE) {
+        attr_.type = value == "saturate"           ? SvgFeColorMatrixType::SATURATE
+                     : value == "hueRotate"        ? SvgFeColorMatrixType::HUE_ROTATE
+                     : value == "luminanceToAlpha" ? SvgFeColorMatrixType::LUMINACE_TO_ALPHA
+                                                   : SvgFeColorMatrixType::MATRIX;
+    } else if (name == DOM_SVG_FE_VALUES) {
+        attr_.values = value;
+    } else {
+        return false;
+    }
+    std::vector<float> values;
+    StringUtils::ParseStringToArray(attr_.values, values);
+    BuildColorMatrix(attr_.type, values, matrix_);
+    return true;
+}
+
+} // namespace rnoh
@@ -0,0 +1,23 @@
+#pragma once
+#include "SvgFe.h"
+
+namespace rnoh {
+
+class SvgFeColorMatrix : public SvgFe {
+public:
+    SvgFeColorMatrix();
+    ~SvgFeColorMatrix() override = default;
+
+    void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+               const FilterUnits& units) const override;
+
+protected:
+    bool ParseFeAttr(const std::string& name, const std::string& value) override;
+
+private:
+    SvgFeColorMatrixAttribute attr_;
+    // attr_ as a 4x5 matrix, rebuilt when type or values change
+    float matrix_[20];
+};
+
+} // namespace rnoh
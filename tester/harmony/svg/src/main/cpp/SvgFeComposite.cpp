@@ -0,0 +1,45 @@
+#include "SvgFeComposite.h"
+#include "properties/SvgDomType.h"
+#include "utils/LinearMap.h"
+#include "utils/Utils.h"
+
+namespace rnoh {
+
+void SvgFeComposite::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output,
+                           const PixelRect& region, const FilterUnits& units) const
+{
+    const float k[4] = {attr_.k1, attr_.k2, attr_.k3, attr_.k4};
+    Composite(inputs[0], inputs[1], output, region, attr_.operatorType, k);
+}
+
+bool SvgFeComposite::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    static const LinearMapNode<SvgFeOperatorType> OPERATORS[] = {
+        {"arithmetic", SvgFeOperatorType::FE_ARITHMETIC},
+        {"atop", SvgFeOperatorType::FE_ATOP},
+        {"in", SvgFeOperatorType::FE_IN},
+        {"lighter", SvgFeOperatorType::FE_LIGHTER},
+        {"out", SvgFeOperatorType::FE_OUT},
+        {"over", SvgFeOperatorType::FE_OVER},
+        {"xor", SvgFeOperatorType::FE_XOR},
+    };
+    if (name == DOM_SVG_FE_IN2) {
+        attr_.in2 = ParseFeIn(value);
+    } else if (name == DOM_SVG_FE_OPERATOR_TYPE) {
+        auto index = BinarySearchFindIndex(OPERATORS, ArraySize(OPERATORS), value.c_str());
+        attr_.operatorType = index < 0 ? SvgFeOperatorType::FE_OVER : OPERATORS[index].value;
+    } else if (name == DOM_SVG_FE_K1) {
+        attr_.k1 = SvgAttributesParser::ParseDouble(value);
+    } else if (name == DOM_SVG_FE_K2) {
+        attr_.k2 = SvgAttributesParser::ParseDouble(value);
+    } else if (name == DOM_SVG_FE_K3) {
+        attr_.k3 = SvgAttributesParser::ParseDouble(value);
+    } else if (name == DOM_SVG_FE_K4) {
+        attr_.k4 = SvgAttributesParser::ParseDouble(value);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace rnoh
@@ -0,0 +1,39 @@
+#include "SvgFeFlood.h"
+#include <algorithm>
+#include "properties/SvgDomType.h"
+#include "utils/ColorSpace.h"
+
+namespace rnoh {
+
+void SvgFeFlood::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+                       const FilterUnits& units) const
+{
+    const auto& color = attr_.floodColor;
+    const double alpha = color.GetAlpha() / 255.0 * std::clamp(attr_.floodOpacity, 0.0, 1.0);
+    uint8_t pixel[4] = {
+        static_cast<uint8_t>(color.GetRed() * alpha + 0.5),
+        static_cast<uint8_t>(color.GetGreen() * alpha + 0.5),
+        static_cast<uint8_t>(color.GetBlue() * alpha + 0.5),
+        static_cast<uint8_t>(255.0 * alpha + 0.5),
+    };
+    // the graph hands the output back to sRGB
+    if (feAttr_.colorInterpolationType == SvgColorInterpolationType::LINEAR_RGB) {
+        SrgbToLinearRow(pixel, 1);
+    }
+    FillRect(output, region, pixel);
+}
+
+bool SvgFeFlood::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_FE_FLOOD_COLOR) {
+        attr_.floodColor = SvgAttributesParser::GetColor(value);
+        return true;
+    }
+    if (name == DOM_SVG_FE_FLOOD_OPACITY) {
+        attr_.floodOpacity = SvgAttributesParser::ParseDouble(value);
+        return true;
+    }
+    return false;
+}
+
+} // namespace rnoh
@@ -0,0 +1,23 @@
+#pragma once
+#include "SvgFe.h"
+
+namespace rnoh {
+
+class SvgFeFlood : public SvgFe {
+public:
+    SvgFeFlood() = default;
+    ~SvgFeFlood() override = default;
+
+    // flood reads no image
+    void GetInputs(std::vector<SvgFeIn>& inputs) const override {}
+    void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+               const FilterUnits& units) const override;
+
+protected:
+    bool ParseFeAttr(const std::string& name, const std::string& value) override;
+
+private:
+    SvgFeFloodAttribute attr_;
+};
+
+} // namespace rnoh
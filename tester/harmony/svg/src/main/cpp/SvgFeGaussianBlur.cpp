@@ -0,0 +1,34 @@
+#include "SvgFeGaussianBlur.h"
+#include <algorithm>
+#include "properties/SvgDomType.h"
+#include "utils/StringUtils.h"
+
+namespace rnoh {
+
+void SvgFeGaussianBlur::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output,
+                              const PixelRect& region, const FilterUnits& units) const
+{
+    GaussianBlur(inputs[0], output, region, attr_.stdDeviationX * units.scaleX, attr_.stdDeviationY * units.scaleY,
+                 attr_.edgeMode);
+}
+
+bool SvgFeGaussianBlur::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_FE_STD_DEVIATION) {
+        std::vector<float> deviations;
+        StringUtils::ParseStringToArray(value, deviations);
+        // negative deviations disable the blur
+        attr_.stdDeviationX = deviations.empty() ? 0.0f : std::max(deviations[0], 0.0f);
+        attr_.stdDeviationY = deviations.size() > 1 ? std::max(deviations[1], 0.0f) : attr_.stdDeviationX;
+        return true;
+    }
+    if (name == DOM_SVG_FE_EDGE_MODE) {
+        attr_.edgeMode = value == "wrap"   ? SvgFeEdgeMode::EDGE_WRAP
+                         : value == "none" ? SvgFeEdgeMode::EDGE_NONE
+                                           : SvgFeEdgeMode::EDGE_DUPLICATE;
+        return true;
+    }
+    return false;
+}
+
+} // namespace rnoh
@@ -0,0 +1,21 @@
+#pragma once
+#include "SvgFe.h"
+
+namespace rnoh {
+
+class SvgFeGaussianBlur : public SvgFe {
+public:
+    SvgFeGaussianBlur() = default;
+    ~SvgFeGaussianBlur() override = default;
+
+    void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+               const FilterUnits& units) const override;
+
+protected:
+    bool ParseFeAttr(const std::string& name, const std::string& value) override;
+
+private:
+    SvgFeGaussianBlurAttribute attr_;
+};
+
+} // namespace rnoh
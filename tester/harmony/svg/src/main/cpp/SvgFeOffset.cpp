@@ -0,0 +1,28 @@
+#include "SvgFeOffset.h"
+#include <cmath>
+#include "properties/SvgDomType.h"
+
+namespace rnoh {
+
+void SvgFeOffset::Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+                        const FilterUnits& units) const
+{
+    // whole pixels keep the shifted copy a memcpy per row
+    OffsetRect(inputs[0], output, region, static_cast<int32_t>(std::lround(attr_.dx.Value() * units.scaleX)),
+               static_cast<int32_t>(std::lround(attr_.dy.Value() * units.scaleY)));
+}
+
+bool SvgFeOffset::ParseFeAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_DX) {
+        attr_.dx = SvgAttributesParser::ParseDimension(value);
+        return true;
+    }
+    if (name == DOM_SVG_DY) {
+        attr_.dy = SvgAttributesParser::ParseDimension(value);
+        return true;
+    }
+    return false;
+}
+
+} // namespace rnoh
@@ -0,0 +1,21 @@
+#pragma once
+#include "SvgFe.h"
+
+namespace rnoh {
+
+class SvgFeOffset : public SvgFe {
+public:
+    SvgFeOffset() = default;
+    ~SvgFeOffset() override = default;
+
+    void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+               const FilterUnits& units) const override;
+
+protected:
+    bool ParseFeAttr(const std::string& name, const std::string& value) override;
+
+private:
+    SvgFeOffsetAttribute attr_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,180 @@
+#include "SvgFilter.h"
+#include <native_drawing/drawing_rect.h>
+#include <algorithm>
+#include <cmath>
+#include "properties/SvgDomType.h"
+
+namespace rnoh {
+namespace {
+// targets filtered at once, e.g. the visible cards of a list sharing a shadow
+constexpr size_t MAX_CACHED_OUTPUTS = 4;
+// larger regions are filtered at a lower resolution and scaled up
+constexpr float MAX_FILTER_SIZE = 4096.0f;
+const char OBJECT_BOUNDING_BOX[] = "objectBoundingBox";
+} // namespace
+
+SvgFilter::SvgFilter() : SvgQuote()
+{
+    sampling_ = OH_Drawing_SamplingOptionsCreate(FILTER_MODE_LINEAR, MIPMAP_MODE_NONE);
+}
+
+SvgFilter::~SvgFilter()
+{
+    OH_Drawing_SamplingOptionsDestroy(sampling_);
+}
+
+bool SvgFilter::ParseAndSetSpecializedAttr(const std::string& name, const std::string& value)
+{
+    if (name == DOM_SVG_X) {
+        attr_.x = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_Y) {
+        attr_.y = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_WIDTH) {
+        attr_.width = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_HEIGHT) {
+        attr_.height = SvgAttributesParser::ParseDimension(value, true);
+    } else if (name == DOM_SVG_FILTER_UNITS) {
+        filterUnits_ = value;
+    } else if (name == DOM_SVG_PRIMITIVE_UNITS) {
+        primitiveUnits_ = value;
+    } else {
+        return false;
+    }
+    MarkDirty();
+    return true;
+}
+
+bool SvgFilter::HashContent(WideHash& seed) const
+{
+    HashDimension(seed, attr_.x);
+    HashDimension(seed, attr_.y);
+    HashDimension(seed, attr_.width);
+    HashDimension(seed, attr_.height);
+    HashCombine(seed, filterUnits_);
+    HashCombine(seed, primitiveUnits_);
+    return true;
+}
+
+void SvgFilter::Compile()
+{
+    primitives_.clear();
+    std::vector<const FilterEffect*> effects;
+    for (const auto& child : children_) {
+        if (auto* primitive = dynamic_cast<const SvgFe*>(child.get())) {
+            primitives_.push_back(primitive);
+            effects.push_back(primitive);
+        }
+    }
+    graph_.Compile(std::move(effects));
+    outputs_.clear();
+    compiledGeneration_ = generation_;
+}
+
+Rect SvgFilter::GetPrimitiveRegion(const SvgFeCommonAttribute& attr, const Rect& region, const Rect& bounds) const
+{
+    // percentages are taken against the filter region, so the default
+    // subregion of 0%, 0%, 100%, 100% is the filter region itself
+    const bool boundingBox = primitiveUnits_ == OBJECT_BOUNDING_BOX;
+    auto resolve = [&](const Dimension& value, double regionStart, double regionLength, double boxStart,
+                       double boxLength) {
+        if (value.Unit() == DimensionUnit::PERCENT) {
+            return regionStart + value.Value() * regionLength;
+        }
+        if (boundingBox) {
+            return boxStart + value.Value() * boxLength;
+        }
+        return ConvertDimensionToPx(value, Size(), SvgLengthType::OTHER);
+    };
+    const double left = resolve(attr.x, region.Left(), region.Width(), bounds.Left(), bounds.Width());
+    const double top = resolve(attr.y, region.Top(), region.Height(), bounds.Top(), bounds.Height());
+    const double width = resolve(attr.width, 0.0, region.Width(), 0.0, bounds.Width());
+    const double height = resolve(attr.height, 0.0, region.Height(), 0.0, bounds.Height());
+    return Rect(left, top, width, height);
+}
+
+std::unique_ptr<OffscreenSurface> SvgFilter::Render(const Rect& region, const Rect& bounds, float scale,
+                                                    const std::function<void(OH_Drawing_Canvas*)>& drawContent)
+{
+    const float rasterScale =
+        std::min(scale, MAX_FILTER_SIZE / static_cast<float>(std::max(region.Width(), region.Height())));
+    const auto width = static_cast<uint32_t>(std::ceil(region.Width() * rasterScale));
+    const auto height = static_cast<uint32_t>(std::ceil(region.Height() * rasterScale));
+    pool_.SetSize(width, height);
+    auto source = pool_.Acquire();
+    if (!source) {
+        return nullptr;
+    }
+    auto* canvas = source->GetCanvas();
+    OH_Drawing_CanvasSave(canvas);
+    OH_Drawing_CanvasScale(canvas, rasterScale, rasterScale);
+    OH_Drawing_CanvasTranslate(canvas, -region.Left(), -region.Top());
+    drawContent(canvas);
+    OH_Drawing_CanvasRestore(canvas);
+
+    std::vector<PixelRect> regions;
+    regions.reserve(primitives_.size());
+    for (const auto* primitive : primitives_) {
+        const auto subregion = GetPrimitiveRegion(primitive->GetCommonAttr(), region, bounds);
+        PixelRect pixels;
+        pixels.left = static_cast<int32_t>(std::floor((subregion.Left() - region.Left()) * rasterScale));
+        pixels.top = static_cast<int32_t>(std::floor((subregion.Top() - region.Top()) * rasterScale));
+        pixels.right = static_cast<int32_t>(std::ceil((subregion.Right() - region.Left()) * rasterScale));
+        pixels.bottom = static_cast<int32_t>(std::ceil((subregion.Bottom() - region.Top()) * rasterScale));
+        pixels.left = std::max(pixels.left, 0);
+        pixels.top = std::max(pixels.top, 0);
+        pixels.right = std::min(pixels.right, static_cast<int32_t>(width));
+        pixels.bottom = std::min(pixels.bottom, static_cast<int32_t>(height));
+        regions.push_back(pixels);
+    }
+    FilterUnits units;
+    if (primitiveUnits_ == OBJECT_BOUNDING_BOX) {
+        units.scaleX = bounds.Width() * rasterScale;
+        units.scaleY = bounds.Height() * rasterScale;
+    } else {
+        units.scaleX = units.scaleY = vpToPx(1.0) * rasterScale;
+    }
+    return graph_.Run(pool_, std::move(source), regions, units);
+}
+
+void SvgFilter::DrawFiltered(OH_Drawing_Canvas* canvas, SvgNode& target, const Rect& bounds, float scale,
+                             const std::function<void(OH_Drawing_Canvas*)>& drawContent)
+{
+    if (compiledGeneration_ != generation_) {
+        Compile();
+    }
+    const auto region = ResolveRegion(attr_.x, attr_.y, attr_.width, attr_.height,
+                                      filterUnits_ == OBJECT_BOUNDING_BOX, bounds);
+    // a filter without primitives or region leaves the target undrawn
+    if (graph_.IsEmpty() || !region.IsValid()) {
+        return;
+    }
+    const uint64_t referencedGeneration = target.GetReferencedGeneration();
+    OffscreenSurface* output = nullptr;
+    for (auto& cached : outputs_) {
+        if (cached.target == &target && cached.targetGeneration == target.GetGeneration() &&
+            cached.referencedGeneration == referencedGeneration && cached.scale == scale && IsSameBounds(cached.bounds, bounds)) {
+            output = cached.surface.get();
+            break;
+        }
+    }
+    if (!output) {
+        auto surface = Render(region, bounds, scale, drawContent);
+        if (!surface) {
+            return;
+        }
+        outputs_.erase(std::remove_if(outputs_.begin(), outputs_.end(),
+                                      [&target](const FilterOutput& cached) { return cached.target == &target; }),
+                       outputs_.end());
+        if (outputs_.size() >= MAX_CACHED_OUTPUTS) {
+            outputs_.erase(outputs_.begin());
+        }
+        outputs_.push_back(
+            {&target, target.GetGeneration(), referencedGeneration, bounds, scale, std::move(surface)});
+        output = outputs_.back().surface.get();
+    }
+    auto* rect = OH_Drawing_RectCreate(region.Left(), region.Top(), region.Right(), region.Bottom());
+    OH_Drawing_CanvasDrawImageRect(canvas, output->GetImage(), rect, sampling_);
+    OH_Drawing_RectDestroy(rect);
+}
+
+} // namespace rnoh
@@ -0,0 +1,65 @@
+#pragma once
+#include <native_drawing/drawing_sampling_options.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "SvgFe.h"
+#include "SvgQuote.h"
+#include "utils/FilterGraph.h"
+#include "utils/SvgAttributesParser.h"
+
+namespace rnoh {
+
+class SvgFilter : public SvgQuote {
+public:
+    SvgFilter();
+    ~SvgFilter() override;
+
+    SvgFilterAttribute attr_;
+    std::string filterUnits_ = "objectBoundingBox";
+    std::string primitiveUnits_ = "userSpaceOnUse";
+
+    bool ParseAndSetSpecializedAttr(const std::string& name, const std::string& value) override;
+
+    // Draws a target through the filter: drawContent renders the target into
+    // the filter region at the target's device scale, the primitives run on
+    // that and the result is drawn in place of the target.
+    void DrawFiltered(OH_Drawing_Canvas* canvas, SvgNode& target, const Rect& bounds, float scale,
+                      const std::function<void(OH_Drawing_Canvas*)>& drawContent);
+
+    // surfaces the primitives ran on, allocated since the filter was created
+    size_t GetSurfaceAllocations() const
+    {
+        return pool_.GetAllocations();
+    }
+
+protected:
+    bool HashContent(WideHash& seed) const override;
+
+private:
+    // result for one target, kept until the target or the filter changes
+    struct FilterOutput {
+        const SvgNode* target;
+        uint64_t targetGeneration;
+        // content drawn through href, e.g. by a <use> in the target
+        uint64_t referencedGeneration;
+        Rect bounds;
+        float scale;
+        std::unique_ptr<OffscreenSurface> surface;
+    };
+
+    // Collects the primitives and resolves their references.
+    void Compile();
+    Rect GetPrimitiveRegion(const SvgFeCommonAttribute& attr, const Rect& region, const Rect& bounds) const;
+    std::unique_ptr<OffscreenSurface> Render(const Rect& region, const Rect& bounds, float scale,
+                                             const std::function<void(OH_Drawing_Canvas*)>& drawContent);
+
+    std::vector<const SvgFe*> primitives_;
+    FilterGraph graph_;
+    uint64_t compiledGeneration_ = 0;
+    FilterSurfacePool pool_;
+    std::vector<FilterOutput> outputs_;
+    OH_Drawing_SamplingOptions* sampling_;
+};
+
+} // namespace rnoh
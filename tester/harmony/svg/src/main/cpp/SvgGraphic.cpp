@@ -14,7 +14,11 @@
  */
 
 #include "SvgGraphic.h"
+#include "SvgMarker.h"
+#include "SvgPattern.h"
 #include <native_drawing/drawing_path_effect.h>
+#include <native_drawing/drawing_rect.h>
+#include "properties/SvgDomType.h"
 
 namespace rnoh {
 
@@ -22,16 +26,229 @@ void SvgGraphic::OnDraw(OH_Drawing_Canvas *canvas) {
     LOG(INFO) << "[SVGGraphic] onDraw";
     //     OH_Drawing_BrushReset(fillBrush_);
     //     OH_Drawing_PenReset(strokePen_);
-    // 获取子类的绘制路径。
-    path_ = AsPath();
-    if (UpdateFillStyle()) {
+    UpdatePath();
+    if (UpdateFillPattern(canvas) || UpdateFillStyle()) {
         OnGraphicFill(canvas);
     }
 //     OnGraphicFill(canvas);
     UpdateStrokeStyle();
     OnGraphicStroke(canvas);
+    if (hrefMarkerStart_ != SVG_ID_NONE || hrefMarkerMid_ != SVG_ID_NONE || hrefMarkerEnd_ != SVG_ID_NONE) {
+        OnGraphicMarkers(canvas);
+    }
+}
+
+bool SvgGraphic::PrepareFlatDraw(SvgDrawRecord &record) {
+    if (HasDrawEffects() || hrefFillId_ != SVG_ID_NONE || hrefMarkerStart_ != SVG_ID_NONE ||
+        hrefMarkerMid_ != SVG_ID_NONE || hrefMarkerEnd_ != SVG_ID_NONE) {
+        return false;
+    }
+    // same state OnDraw() leaves the brush and pen in
+    UpdatePath();
+    record.op = SvgDrawOp::SHAPE;
+    record.path = path_;
+    record.brush = UpdateFillStyle() ? fillBrush_ : nullptr;
+    UpdateStrokeStyle();
+    record.pen = strokePen_;
+    return true;
+}
+
+void SvgGraphic::OnGraphicMarkers(OH_Drawing_Canvas *canvas) {
+    if (markerGeneration_ != generation_) {
+        const auto *pathData = AsPathData();
+        if (pathData) {
+            ComputeMarkerVertices(*pathData, markerVertices_);
+        } else {
+            markerVertices_.clear();
+        }
+        markerGeneration_ = generation_;
+    }
+    if (markerVertices_.empty()) {
+        return;
+    }
+    const double strokeWidth = attributes_.strokeState.GetLineWidth().Value() / vpToPx(1.0);
+    const std::pair<SvgIdHandle, MarkerPosition> markers[] = {{hrefMarkerStart_, MarkerPosition::START},
+                                                              {hrefMarkerMid_, MarkerPosition::MID},
+                                                              {hrefMarkerEnd_, MarkerPosition::END}};
+    for (const auto &[handle, position] : markers) {
+        auto *marker = dynamic_cast<SvgMarker *>(context_->GetSvgNodeByHandle(handle));
+        if (marker) {
+            marker->DrawMarkers(canvas, markerVertices_, position, strokeWidth);
+        }
+    }
+}
+void SvgGraphic::UpdatePath() {
+    if (pathGeneration_ == generation_) {
+        return;
+    }
+    OH_Drawing_PathReset(path_);
+    // shapes append to path_, others hand back a path of their own
+    auto *path = AsPath();
+    if (path && path != path_) {
+        OH_Drawing_PathAddPath(path_, path, nullptr);
+        OH_Drawing_PathDestroy(path);
+    }
+    pathGeneration_ = generation_;
+}
+
+OH_Drawing_Path *SvgGraphic::CopyPath() {
+    UpdatePath();
+    return OH_Drawing_PathCopy(path_);
+}
+
+uint64_t SvgGraphic::GetReferencedGeneration() {
+    return SvgNode::GetReferencedGeneration() + GetHrefGeneration(hrefFillId_) + GetHrefGeneration(hrefMarkerStart_) +
+        GetHrefGeneration(hrefMarkerMid_) + GetHrefGeneration(hrefMarkerEnd_);
+}
+
+void SvgGraphic::UpdateBounds() {
+    if (boundsGeneration_ == generation_) {
+        return;
+    }
+    UpdatePath();
+    auto *rect = OH_Drawing_RectCreate(0, 0, 0, 0);
+    OH_Drawing_PathGetBounds(path_, rect);
+    bounds_ = Rect(OH_Drawing_RectGetLeft(rect), OH_Drawing_RectGetTop(rect),
+                   OH_Drawing_RectGetRight(rect) - OH_Drawing_RectGetLeft(rect),
+                   OH_Drawing_RectGetBottom(rect) - OH_Drawing_RectGetTop(rect));
+    OH_Drawing_RectDestroy(rect);
+    boundsGeneration_ = generation_;
+}
+
+void SvgGraphic::UpdateArcLengths() {
+    if (arcLengthGeneration_ == generation_) {
+        return;
+    }
+    const auto *pathData = AsPathData();
+    if (pathData) {
+        BuildArcLengthTable(*pathData, arcLengths_);
+        pathLength_ = arcLengths_.Total();
+    } else {
+        UpdatePath();
+        arcLengths_.Clear();
+        pathLength_ = OH_Drawing_PathGetLength(path_, false) / vpToPx(1.0);
+    }
+    arcLengthGeneration_ = generation_;
+}
+
+Rect SvgGraphic::AsBounds() {
+    UpdateBounds();
+    return bounds_;
+}
+
+double SvgGraphic::GetPaintOutset() {
+    double outset = SvgNode::GetPaintOutset();
+    const auto &stroke = attributes_.strokeState;
+    // miter joins reach miterLimit half widths out, square caps a diagonal
+    double reach = 1.0;
+    if (stroke.GetLineJoin() == LineJoinStyle::MITER) {
+        reach = std::max(reach, stroke.GetMiterLimit());
+    }
+    if (stroke.GetLineCap() == LineCapStyle::SQUARE) {
+        reach = std::max(reach, M_SQRT2);
+    }
+    outset = std::max(outset, stroke.GetLineWidth().Value() * 0.5 * reach);
+    if (context_) {
+        const double strokeWidth = stroke.GetLineWidth().Value() / vpToPx(1.0);
+        for (auto handle : {hrefMarkerStart_, hrefMarkerMid_, hrefMarkerEnd_}) {
+            if (auto *marker = dynamic_cast<SvgMarker *>(context_->GetSvgNodeByHandle(handle))) {
+                outset = std::max(outset, marker->GetExtent(strokeWidth));
+            }
+        }
+    }
+    return outset;
 }
+
+void SvgGraphic::PrepareGeometry() {
+    UpdatePath();
+    UpdateBounds();
+    UpdateArcLengths();
+}
+
+float SvgGraphic::GetPathLength() {
+    UpdateArcLengths();
+    return pathLength_;
+}
+
+bool SvgGraphic::GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const {
+    const auto &fill = attributes_.fillState;
+    const auto &stroke = attributes_.strokeState;
+    if (name == DOM_SVG_FILL || name == DOM_SVG_STROKE) {
+        value.kind = SvgAnimatedValue::Kind::COLOR;
+        value.color = name == DOM_SVG_FILL ? fill.GetColor() : stroke.GetColor();
+        return true;
+    }
+    if (name == DOM_SVG_SRC_FILL_OPACITY) {
+        return GetAnimatedField(fill.GetOpacity(), value);
+    }
+    if (name == DOM_SVG_SRC_STROKE_OPACITY) {
+        return GetAnimatedField(stroke.GetOpacity(), value);
+    }
+    // kept in px, animated in user units
+    if (name == DOM_SVG_SRC_STROKE_WIDTH) {
+        return GetAnimatedField(stroke.GetLineWidth().Value() / vpToPx(1.0), value);
+    }
+    if (name == DOM_SVG_SRC_STROKE_DASHOFFSET) {
+        return GetAnimatedField(stroke.GetLineDash().dashOffset / vpToPx(1.0), value);
+    }
+    return SvgNode::GetAnimatedAttr(name, value);
+}
+
+bool SvgGraphic::SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) {
+    SvgAnimatedValue current;
+    if (value.kind == SvgAnimatedValue::Kind::TRANSFORM || !GetAnimatedAttr(name, current) ||
+        current.kind != value.kind) {
+        return SvgNode::SetAnimatedAttr(name, value);
+    }
+    if (value.kind == SvgAnimatedValue::Kind::COLOR ? current.color == value.color : current.number == value.number) {
+        return true;
+    }
+    auto &fill = attributes_.fillState;
+    auto &stroke = attributes_.strokeState;
+    if (name == DOM_SVG_FILL) {
+        fill.SetColor(value.color);
+    } else if (name == DOM_SVG_STROKE) {
+        stroke.SetColor(value.color);
+    } else if (name == DOM_SVG_SRC_FILL_OPACITY) {
+        fill.SetOpacity(std::clamp(value.number, 0.0, 1.0));
+    } else if (name == DOM_SVG_SRC_STROKE_OPACITY) {
+        stroke.SetOpacity(std::clamp(value.number, 0.0, 1.0));
+    } else if (name == DOM_SVG_SRC_STROKE_WIDTH) {
+        stroke.SetLineWidth(Dimension(vpToPx(std::max(value.number, 0.0))));
+    } else if (name == DOM_SVG_SRC_STROKE_DASHOFFSET) {
+        stroke.SetLineDashOffset(vpToPx(value.number));
+    } else {
+        return SvgNode::SetAnimatedAttr(name, value);
+    }
+    MarkDirty();
+    return true;
+}
+
+bool SvgGraphic::UpdateFillPattern(OH_Drawing_Canvas *canvas, bool antiAlias) {
+    if (hrefFillId_ == SVG_ID_NONE) {
+        return false;
+    }
+    auto *pattern = dynamic_cast<SvgPattern *>(context_->GetSvgNodeByHandle(hrefFillId_));
+    if (!pattern) {
+        return false;
+    }
+    auto *shader = pattern->GetShader(AsBounds(), GetDeviceScaleBucket());
+    if (!shader) {
+        return false;
+    }
+    double curOpacity = attributes_.fillState.GetOpacity() * opacity_ * (1.0f / UINT8_MAX);
+    OH_Drawing_BrushSetAntiAlias(fillBrush_, antiAlias);
+    OH_Drawing_BrushSetColor(fillBrush_, Color::BLACK.BlendOpacity(curOpacity).GetValue());
+    OH_Drawing_BrushSetShaderEffect(fillBrush_, shader);
+    fillShaderSet_ = true;
+    return true;
+}
+
 bool SvgGraphic::UpdateFillStyle(bool antiAlias) {
+    if (fillShaderSet_) {
+        OH_Drawing_BrushSetShaderEffect(fillBrush_, nullptr);
+        fillShaderSet_ = false;
+    }
     const auto &fillState_ = attributes_.fillState;
     if (fillState_.GetColor() == Color::TRANSPARENT && !fillState_.GetGradient()) {
         return false;
@@ -146,6 +363,8 @@ void SvgGraphic::UpdateLineDash() {
         float phase = static_cast<float>(strokeState.GetLineDash().dashOffset);
         auto *DashPathEffect = OH_Drawing_CreateDashPathEffect(intervals, lineDashState.size(), phase);
         OH_Drawing_PenSetPathEffect(strokePen_, DashPathEffect);
+        // the pen holds its own reference, an animated dashoffset gets here every frame
+        OH_Drawing_PathEffectDestroy(DashPathEffect);
     }
 }
 
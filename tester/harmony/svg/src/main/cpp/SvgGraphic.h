@@ -10,10 +10,13 @@
 #include <native_drawing/drawing_path.h>
 #include <native_drawing/drawing_pen.h>
 #include "SvgNode.h"
+#include "SvgDrawList.h"
 #include "RNOH/CppComponentInstance.h"
 #include "utils/StringUtils.h"
 #include "utils/SvgAttributesParser.h"
 #include "utils/StringUtils.h"
+#include "utils/PathGeometry.h"
+#include "utils/GraphicPaintPool.h"
 #include "utils/Utils.h"
 
 namespace rnoh {
@@ -21,20 +24,52 @@ namespace rnoh {
 class SvgGraphic : public SvgNode {
 public:
     SvgGraphic() : SvgNode() {
-        fillBrush_ = OH_Drawing_BrushCreate();
-        strokePen_ = OH_Drawing_PenCreate();
-        path_ = OH_Drawing_PathCreate();
+        auto paints = GraphicPaintPool::GetInstance().Acquire();
+        fillBrush_ = paints.brush;
+        strokePen_ = paints.pen;
+        path_ = paints.path;
     }
     //     virtual ~SvgGraphic() override = default;
-    ~SvgGraphic() override {
-        OH_Drawing_BrushDestroy(fillBrush_);
-        OH_Drawing_PenDestroy(strokePen_);
-        OH_Drawing_PathDestroy(path_);
-    }
+    ~SvgGraphic() override { GraphicPaintPool::GetInstance().Release({fillBrush_, strokePen_, path_}); }
 
 
     void OnDraw(OH_Drawing_Canvas *canvas) override;
 
+    Rect AsBounds() override;
+    double GetPaintOutset() override;
+
+    bool GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const override;
+    bool SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) override;
+
+    // Builds path_, the bounds and the arc length table for the current
+    // generation.
+    void PrepareGeometry() override;
+
+    // Copy of path_, which AsPath() of shapes hands out.
+    OH_Drawing_Path *CopyPath() override;
+    // Adds the paint server and the markers.
+    uint64_t GetReferencedGeneration() override;
+
+    // Length of the outline in user units.
+    float GetPathLength();
+    // Flattened outline in user units, empty for shapes without AsPathData().
+    const ArcLengthTable &GetArcLengths() {
+        UpdateArcLengths();
+        return arcLengths_;
+    }
+
+    // id of the paint server filling the shape, empty for a plain color
+    void SetFillRef(const std::string &id) { BindRef(hrefFillId_, id); }
+
+    void SetMarkerRefs(const std::string &start, const std::string &mid, const std::string &end) {
+        BindRef(hrefMarkerStart_, start);
+        BindRef(hrefMarkerMid_, mid);
+        BindRef(hrefMarkerEnd_, end);
+    }
+
+    // Geometry markers are placed on, nullptr for shapes that take none.
+    virtual const PathData *AsPathData() { return nullptr; }
+
     // temporary
     void setBrushColor(const uint32_t fill,double fillOpacity) { 
 //         OH_Drawing_BrushSetColor(fillBrush_, fill);
@@ -72,6 +107,21 @@ public:
     
 protected:
     OH_Drawing_Path *path_;
+    uint64_t pathGeneration_ = 0;
+    Rect bounds_;
+    uint64_t boundsGeneration_ = 0;
+    // empty for shapes without AsPathData(), pathLength_ is then measured on path_
+    ArcLengthTable arcLengths_;
+    float pathLength_ = 0.0f;
+    uint64_t arcLengthGeneration_ = 0;
+    SvgIdHandle hrefFillId_ = SVG_ID_NONE;
+    bool fillShaderSet_ = false;
+    SvgIdHandle hrefMarkerStart_ = SVG_ID_NONE;
+    SvgIdHandle hrefMarkerMid_ = SVG_ID_NONE;
+    SvgIdHandle hrefMarkerEnd_ = SVG_ID_NONE;
+    // vertices of AsPathData(), recomputed when the node changes
+    std::vector<MarkerVertex> markerVertices_;
+    uint64_t markerGeneration_ = 0;
     OH_Drawing_Brush *fillBrush_;
     OH_Drawing_Pen *strokePen_;
 
@@ -85,8 +135,8 @@ protected:
                 OH_Drawing_MaskFilterCreateBlur(OH_Drawing_BlurType::NORMAL, static_cast<double>(smoothEdge), false);
             OH_Drawing_FilterSetMaskFilter(filter, maskFilter);
 
-            /* copy constructor missing */
-            auto tmpFillBrush = fillBrush_;
+            // fillBrush_ goes back to the pool, the filter must not stick to it
+            auto tmpFillBrush = OH_Drawing_BrushCopy(fillBrush_);
             OH_Drawing_BrushSetFilter(tmpFillBrush, filter);
             OH_Drawing_CanvasAttachBrush(canvas, tmpFillBrush);
             OH_Drawing_CanvasDrawPath(canvas, path_);
@@ -113,8 +163,7 @@ protected:
                 OH_Drawing_MaskFilterCreateBlur(OH_Drawing_BlurType::NORMAL, static_cast<double>(smoothEdge), false);
             OH_Drawing_FilterSetMaskFilter(filter, maskFilter);
 
-            /* copy constructor missing */
-            auto tmpStrokePen = strokePen_;
+            auto tmpStrokePen = OH_Drawing_PenCopy(strokePen_);
             OH_Drawing_PenSetFilter(tmpStrokePen, filter);
             OH_Drawing_CanvasAttachPen(canvas, tmpStrokePen);
             OH_Drawing_CanvasDrawPath(canvas, path_);
@@ -131,7 +180,25 @@ protected:
         }
     }
 
+    bool HashContent(WideHash &seed) const override {
+        HashRef(seed, hrefFillId_);
+        HashRef(seed, hrefMarkerStart_);
+        HashRef(seed, hrefMarkerMid_);
+        HashRef(seed, hrefMarkerEnd_);
+        return true;
+    }
+
+    // Plain fill and stroke only, patterns and markers need OnDraw().
+    bool PrepareFlatDraw(SvgDrawRecord &record) override;
+
+    // Rebuilds path_ from AsPath() when the node changed since the last build.
+    void UpdatePath();
+    void UpdateBounds();
+    void UpdateArcLengths();
     bool UpdateFillStyle(bool antiAlias = true);
+    void OnGraphicMarkers(OH_Drawing_Canvas *canvas);
+    // Sets a pattern shader on fillBrush_ when the fill references a pattern.
+    bool UpdateFillPattern(OH_Drawing_Canvas *canvas, bool antiAlias = true);
     bool UpdateStrokeStyle(bool antiAlias = true);
     // TODO void UpdateGradient(const std::pair<float, float> &viewPort);
     void SetGradientStyle(double opacity);
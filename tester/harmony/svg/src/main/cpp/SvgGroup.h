@@ -1,5 +1,6 @@
 #pragma once
 #include "SvgNode.h"
+#include "SvgDrawList.h"
 
 namespace rnoh {
 
@@ -13,6 +14,15 @@ public:
     ~SvgGroup() override = default;
 
 protected:
+    // a group draws nothing of its own
+    bool HashContent(WideHash& seed) const override { return true; }
+
+    bool PrepareFlatDraw(SvgDrawRecord& record) override
+    {
+        record.op = SvgDrawOp::GROUP;
+        return !HasDrawEffects();
+    }
+
     // svg g use
     void InitGroupFlag()
     {
@@ -1,12 +1,35 @@
 #include "SvgHost.h"
+#include <algorithm>
 namespace rnoh {
-void SvgHost::OnChildInsertCommon(
-    const std::shared_ptr<SvgHost>& childSvgHost) {
-    if (!childSvgHost) {
+void SvgHost::InsertChildHost(const void* instance, SvgHost* childSvgHost, std::size_t index) {
+    index = std::min(index, m_children.size());
+    std::size_t nodeIndex = 0;
+    for (std::size_t i = 0; i < index; ++i) {
+        if (m_children[i].host && m_children[i].host->GetSvgNode()) {
+            ++nodeIndex;
+        }
+    }
+    m_children.insert(m_children.begin() + index, {instance, childSvgHost});
+    if (!GetSvgNode() || !childSvgHost || !childSvgHost->GetSvgNode()) {
+        return;
+    }
+    auto lock = LockTree();
+    GetSvgNode()->InsertChild(childSvgHost->GetSvgNode(), nodeIndex);
+}
+
+void SvgHost::RemoveChildHost(const void* instance) {
+    auto item = std::find_if(m_children.begin(), m_children.end(), [instance](const ChildEntry& entry) {
+        return entry.instance == instance;
+    });
+    if (item == m_children.end()) {
         return;
     }
-    auto child = childSvgHost->GetSvgNode();
-    child->SetContext(GetSvgNode()->GetContext());
-    GetSvgNode()->AppendChild(child);
+    auto* childSvgHost = item->host;
+    m_children.erase(item);
+    if (!GetSvgNode() || !childSvgHost || !childSvgHost->GetSvgNode()) {
+        return;
+    }
+    auto lock = LockTree();
+    GetSvgNode()->RemoveChild(childSvgHost->GetSvgNode());
+}
 }
-}
\ No newline at end of file
@@ -1,20 +1,55 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "SvgNode.h"
 namespace rnoh {
 class SvgHost {
  public:
-  void SetSvgNode(const std::shared_ptr<SvgNode>& svgNode) {
+  // tag is the React tag of the owning component instance, through which
+  // native prop updates find the node
+  void SetSvgNode(const std::shared_ptr<SvgNode>& svgNode, int32_t tag = 0) {
     m_svgNode = svgNode;
+    m_svgNode->SetNativeTag(tag);
   };
   const std::shared_ptr<SvgNode>& GetSvgNode() {
     return m_svgNode;
   };
 
-  void OnChildInsertCommon(const std::shared_ptr<SvgHost>& childSvgHost);
+  // child is a component instance and index its position among all of the
+  // component's children. Children without a node (ClipPath, gradients,
+  // views that are no SvgHost) are counted out before it reaches the node.
+  template <typename Child>
+  void OnChildInsertCommon(const std::shared_ptr<Child>& child, std::size_t index) {
+    InsertChildHost(child.get(), std::dynamic_pointer_cast<SvgHost>(child).get(), index);
+  }
+  template <typename Child>
+  void OnChildRemoveCommon(const std::shared_ptr<Child>& child) {
+    RemoveChildHost(child.get());
+  }
+
+  // Taken before mutating the node: once attached to a document its tree may
+  // be read by a worker preparing the next frame.
+  std::unique_lock<std::mutex> LockTree() {
+    auto context = m_svgNode ? m_svgNode->GetContext() : nullptr;
+    if (!context) {
+      return {};
+    }
+    return context->LockTreePreempting();
+  }
 
  private:
+  void InsertChildHost(const void* instance, SvgHost* childSvgHost, std::size_t index);
+  void RemoveChildHost(const void* instance);
+
+  struct ChildEntry {
+    const void* instance;
+    SvgHost* host; // null for children that are no SvgHost
+  };
+
   std::shared_ptr<SvgNode> m_svgNode;
+  // the component's children in order, entries are dropped on removal
+  std::vector<ChildEntry> m_children;
 };
 } // namespace rnoh
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include <native_drawing/drawing_sampling_options.h>
+#include "SvgNode.h"
+#include "utils/ImageCache.h"
+#include "utils/SvgAttributesParser.h"
+#include "utils/ViewBox.h"
+
+namespace rnoh {
+
+// <image>: the source is decoded off the UI thread at the size it is drawn
+// at and shared through ImageCache. Until it arrives nothing is drawn and the
+// frame is marked incomplete, so it is redrawn once the decode lands.
+class SvgImage : public SvgNode {
+public:
+    SvgImage();
+    ~SvgImage() override;
+
+    // Sets attr_.href; a new href gets another decode even if it failed before.
+    void SetSource(const std::string& href);
+
+    SvgImageAttribute attr_;
+    std::string align_;
+    MeetOrSlice meetOrSlice_ = MeetOrSlice::MEET;
+
+    Rect AsBounds() override
+    {
+        return GetBox();
+    }
+
+protected:
+    void OnDraw(OH_Drawing_Canvas* canvas) override;
+    bool HashContent(WideHash& seed) const override;
+
+private:
+    // x, y, width and height in px
+    Rect GetBox() const;
+
+    OH_Drawing_SamplingOptions* sampling_;
+    // last image drawn, which keeps one over the cache budget alive
+    std::shared_ptr<DecodedImage> image_;
+    ImageCacheKey imageKey_;
+};
+
+} // namespace rnoh
@@ -5,3 +5,35 @@
 // please include "napi/native_api.h".
 
 #include "SvgLine.h"
+#include "properties/SvgDomType.h"
+
+namespace rnoh {
+
+namespace {
+const std::pair<const char *, SvgLine::Float SvgLine::*> ANIMATED_FIELDS[] = {
+    {DOM_SVG_X1, &SvgLine::x1},
+    {DOM_SVG_Y1, &SvgLine::y1},
+    {DOM_SVG_X2, &SvgLine::x2},
+    {DOM_SVG_Y2, &SvgLine::y2},
+};
+} // namespace
+
+bool SvgLine::GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return GetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::GetAnimatedAttr(name, value);
+}
+
+bool SvgLine::SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return SetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::SetAnimatedAttr(name, value);
+}
+
+} // namespace rnoh
@@ -16,12 +16,34 @@ public:
     Float x2;
     Float y2;
 
+    bool GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const override;
+    bool SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) override;
+
     OH_Drawing_Path *AsPath() const override {
         LOG(INFO) << "[SvgLine] AsPath";
         OH_Drawing_PathMoveTo(path_, vpToPx(x1), vpToPx(y1));
         OH_Drawing_PathLineTo(path_, vpToPx(x2), vpToPx(y2));
         return path_;
     };
+
+    const PathData *AsPathData() override {
+        lineData_.Clear();
+        lineData_.verbs = {PathVerb::MOVE, PathVerb::LINE};
+        lineData_.points = {{static_cast<float>(x1), static_cast<float>(y1)},
+                            {static_cast<float>(x2), static_cast<float>(y2)}};
+        return &lineData_;
+    }
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        for (Float value : {x1, y1, x2, y2}) {
+            HashCombine(seed, value);
+        }
+        return SvgGraphic::HashContent(seed);
+    }
+
+private:
+    PathData lineData_;
 };
 
 } // namespace rnoh
\ No newline at end of file
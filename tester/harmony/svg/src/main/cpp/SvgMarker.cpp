@@ -0,0 +1,102 @@
+#include "SvgMarker.h"
+#include <native_drawing/drawing_rect.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace rnoh {
+
+bool SvgMarker::HashContent(WideHash& seed) const
+{
+    for (double value : {refX_, refY_, markerWidth_, markerHeight_}) {
+        HashCombine(seed, value);
+    }
+    HashCombine(seed, markerUnits_);
+    HashCombine(seed, orient_);
+    HashRect(seed, viewBox_);
+    HashCombine(seed, align_);
+    HashCombine(seed, static_cast<int>(meetOrSlice_));
+    return true;
+}
+
+const SvgPicture* SvgMarker::GetPicture()
+{
+    if (pictureGeneration_ == generation_) {
+        return picture_.get();
+    }
+    pictureGeneration_ = generation_;
+    const Size viewPort(vpToPx(markerWidth_), vpToPx(markerHeight_));
+    const auto transform = GetViewBoxTransform(viewPort);
+    refPoint_ = GetRefPoint(transform);
+    picture_ = SvgPicture::Record(
+        static_cast<int32_t>(std::ceil(viewPort.Width())), static_cast<int32_t>(std::ceil(viewPort.Height())),
+        [this, &viewPort, &transform](OH_Drawing_Canvas* canvas) {
+            // overflow: hidden is the marker default
+            auto* rect = OH_Drawing_RectCreate(0, 0, viewPort.Width(), viewPort.Height());
+            OH_Drawing_CanvasClipRect(canvas, rect, OH_Drawing_CanvasClipOp::INTERSECT, true);
+            OH_Drawing_RectDestroy(rect);
+            OH_Drawing_CanvasTranslate(canvas, transform.translateX, transform.translateY);
+            OH_Drawing_CanvasScale(canvas, transform.scaleX, transform.scaleY);
+            OnDrawTraversed(canvas);
+        });
+    return picture_.get();
+}
+
+ViewBoxTransform SvgMarker::GetViewBoxTransform(const Size& viewPort) const
+{
+    if (!viewBox_.IsValid()) {
+        return {};
+    }
+    const Rect viewBox(vpToPx(viewBox_.Left()), vpToPx(viewBox_.Top()), vpToPx(viewBox_.Width()),
+                       vpToPx(viewBox_.Height()));
+    return ResolveViewBox(viewBox, viewPort, align_, meetOrSlice_);
+}
+
+PathPoint SvgMarker::GetRefPoint(const ViewBoxTransform& transform) const
+{
+    return {static_cast<float>(vpToPx(refX_) * transform.scaleX + transform.translateX),
+            static_cast<float>(vpToPx(refY_) * transform.scaleY + transform.translateY)};
+}
+
+double SvgMarker::GetExtent(double strokeWidth) const
+{
+    const Size viewPort(vpToPx(markerWidth_), vpToPx(markerHeight_));
+    const auto ref = GetRefPoint(GetViewBoxTransform(viewPort));
+    // the content is clipped to the viewport, placed with the ref point on the vertex
+    const double dx = std::max<double>(std::abs(ref.x), std::abs(viewPort.Width() - ref.x));
+    const double dy = std::max<double>(std::abs(ref.y), std::abs(viewPort.Height() - ref.y));
+    return std::hypot(dx, dy) * (markerUnits_ == "strokeWidth" ? strokeWidth : 1.0);
+}
+
+void SvgMarker::DrawMarkers(OH_Drawing_Canvas* canvas, const std::vector<MarkerVertex>& vertices,
+                            MarkerPosition position, double strokeWidth)
+{
+    const auto* picture = GetPicture();
+    if (!picture) {
+        return;
+    }
+    const bool autoOrient = orient_ == "auto" || orient_ == "auto-start-reverse";
+    const bool reverseStart = orient_ == "auto-start-reverse" && position == MarkerPosition::START;
+    const float fixedAngle = autoOrient ? 0.0f : std::strtof(orient_.c_str(), nullptr);
+    const float scale = markerUnits_ == "strokeWidth" ? static_cast<float>(strokeWidth) : 1.0f;
+    const float unit = vpToPx(1.0);
+    for (const auto& vertex : vertices) {
+        if (vertex.position != position) {
+            continue;
+        }
+        const float angle = autoOrient ? vertex.angle + (reverseStart ? 180.0f : 0.0f) : fixedAngle;
+        OH_Drawing_CanvasSave(canvas);
+        OH_Drawing_CanvasTranslate(canvas, vertex.point.x * unit, vertex.point.y * unit);
+        if (angle != 0.0f) {
+            OH_Drawing_CanvasRotate(canvas, angle, 0, 0);
+        }
+        if (scale != 1.0f) {
+            OH_Drawing_CanvasScale(canvas, scale, scale);
+        }
+        OH_Drawing_CanvasTranslate(canvas, -refPoint_.x, -refPoint_.y);
+        picture->Draw(canvas);
+        OH_Drawing_CanvasRestore(canvas);
+    }
+}
+
+} // namespace rnoh
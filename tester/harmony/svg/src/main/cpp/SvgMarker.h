@@ -0,0 +1,49 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "SvgQuote.h"
+#include "utils/PathGeometry.h"
+#include "utils/SvgPicture.h"
+#include "utils/ViewBox.h"
+
+namespace rnoh {
+
+class SvgMarker : public SvgQuote {
+public:
+    SvgMarker() = default;
+    ~SvgMarker() override = default;
+
+    // user units, as sent by RNSVG
+    double refX_ = 0.0;
+    double refY_ = 0.0;
+    double markerWidth_ = 3.0;
+    double markerHeight_ = 3.0;
+    std::string markerUnits_ = "strokeWidth";
+    std::string orient_;
+    Rect viewBox_;
+    std::string align_;
+    MeetOrSlice meetOrSlice_ = MeetOrSlice::MEET;
+
+    // Replays the marker at every vertex of the given position, strokeWidth
+    // in user units scales markers with strokeWidth markerUnits.
+    void DrawMarkers(OH_Drawing_Canvas* canvas, const std::vector<MarkerVertex>& vertices, MarkerPosition position,
+                     double strokeWidth);
+    // Farthest a marker reaches from its vertex in px, whatever its angle.
+    double GetExtent(double strokeWidth) const;
+
+protected:
+    bool HashContent(WideHash& seed) const override;
+
+private:
+    // marker content clipped to its viewport, recorded once per change
+    const SvgPicture* GetPicture();
+    ViewBoxTransform GetViewBoxTransform(const Size& viewPort) const;
+    PathPoint GetRefPoint(const ViewBoxTransform& transform) const;
+
+    std::shared_ptr<SvgPicture> picture_;
+    uint64_t pictureGeneration_ = 0;
+    // ref point in viewport pixels
+    PathPoint refPoint_{};
+};
+
+} // namespace rnoh
@@ -0,0 +1,133 @@
+#include "SvgMask.h"
+#include <native_drawing/drawing_rect.h>
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+namespace {
+// targets masked at once, e.g. the visible items of a list sharing one mask
+constexpr size_t MAX_CACHED_RASTERS = 4;
+// larger layers are scaled up from a raster of this size
+constexpr float MAX_RASTER_SIZE = 4096.0f;
+
+// mask-type luminance: alpha is the luminance of the premultiplied color, the
+// result is stored premultiplied as white so DST_IN only reads the alpha
+void LuminanceToAlpha(OffscreenSurface& surface)
+{
+    auto* pixel = surface.GetPixels();
+    const size_t count = static_cast<size_t>(surface.Width()) * surface.Height();
+    for (size_t i = 0; i < count; ++i, pixel += 4) {
+        // 0.2125, 0.7154, 0.0721 in 8 bit fixed point
+        const uint8_t luma = static_cast<uint8_t>((54 * pixel[0] + 183 * pixel[1] + 19 * pixel[2] + 128) >> 8);
+        pixel[0] = luma;
+        pixel[1] = luma;
+        pixel[2] = luma;
+        pixel[3] = luma;
+    }
+}
+} // namespace
+
+SvgMask::SvgMask() : SvgQuote()
+{
+    maskBrush_ = OH_Drawing_BrushCreate();
+    OH_Drawing_BrushSetBlendMode(maskBrush_, BLEND_MODE_DST_IN);
+    sampling_ = OH_Drawing_SamplingOptionsCreate(FILTER_MODE_LINEAR, MIPMAP_MODE_NONE);
+}
+
+SvgMask::~SvgMask()
+{
+    OH_Drawing_BrushDestroy(maskBrush_);
+    OH_Drawing_SamplingOptionsDestroy(sampling_);
+}
+
+bool SvgMask::HashContent(WideHash& seed) const
+{
+    HashDimension(seed, attr_.x);
+    HashDimension(seed, attr_.y);
+    HashDimension(seed, attr_.width);
+    HashDimension(seed, attr_.height);
+    HashCombine(seed, attr_.maskContentUnits);
+    HashCombine(seed, attr_.maskUnits);
+    return true;
+}
+
+Rect SvgMask::GetMaskRegion(const Rect& bounds) const
+{
+    return ResolveRegion(attr_.x, attr_.y, attr_.width, attr_.height, attr_.maskUnits == "objectBoundingBox", bounds);
+}
+
+bool SvgMask::BeginMask(OH_Drawing_Canvas* canvas, const Rect& bounds)
+{
+    auto region = GetMaskRegion(bounds);
+    if (!region.IsValid()) {
+        return false;
+    }
+    // the layer bounds are only a hint, clip so content outside the region
+    // is not left unmasked
+    auto* rect = OH_Drawing_RectCreate(region.Left(), region.Top(), region.Right(), region.Bottom());
+    OH_Drawing_CanvasClipRect(canvas, rect, OH_Drawing_CanvasClipOp::INTERSECT, true);
+    OH_Drawing_CanvasSaveLayer(canvas, rect, nullptr);
+    OH_Drawing_RectDestroy(rect);
+    return true;
+}
+
+void SvgMask::EndMask(OH_Drawing_Canvas* canvas, const Rect& bounds, float scale)
+{
+    auto region = GetMaskRegion(bounds);
+    auto* raster = GetRaster(bounds, region, scale);
+    auto* image = raster ? raster->GetImage() : nullptr;
+    auto* rect = OH_Drawing_RectCreate(region.Left(), region.Top(), region.Right(), region.Bottom());
+    OH_Drawing_CanvasSaveLayer(canvas, rect, maskBrush_);
+    if (image) {
+        OH_Drawing_CanvasDrawImageRect(canvas, image, rect, sampling_);
+    }
+    // restores the mask layer, then the content layer from BeginMask
+    OH_Drawing_CanvasRestore(canvas);
+    OH_Drawing_CanvasRestore(canvas);
+    OH_Drawing_RectDestroy(rect);
+}
+
+OffscreenSurface* SvgMask::GetRaster(const Rect& bounds, const Rect& region, float scale)
+{
+    if (rasterGeneration_ != generation_) {
+        rasters_.clear();
+        rasterGeneration_ = generation_;
+    }
+    for (auto& raster : rasters_) {
+        if (raster.scale == scale && IsSameBounds(raster.bounds, bounds)) {
+            return raster.surface.get();
+        }
+    }
+    const float rasterScale = std::min(
+        scale, MAX_RASTER_SIZE / static_cast<float>(std::max(region.Width(), region.Height())));
+    auto surface = std::make_unique<OffscreenSurface>(
+        static_cast<uint32_t>(std::ceil(region.Width() * rasterScale)),
+        static_cast<uint32_t>(std::ceil(region.Height() * rasterScale)));
+    if (!surface->IsValid()) {
+        return nullptr;
+    }
+    RenderRaster(*surface, bounds, region, rasterScale);
+    if (rasters_.size() >= MAX_CACHED_RASTERS) {
+        rasters_.erase(rasters_.begin());
+    }
+    rasters_.push_back({bounds, scale, std::move(surface)});
+    return rasters_.back().surface.get();
+}
+
+void SvgMask::RenderRaster(OffscreenSurface& surface, const Rect& bounds, const Rect& region, float scale)
+{
+    auto* canvas = surface.GetCanvas();
+    OH_Drawing_CanvasScale(canvas, scale, scale);
+    OH_Drawing_CanvasTranslate(canvas, -region.Left(), -region.Top());
+    if (attr_.maskContentUnits == "objectBoundingBox") {
+        // children convert their coordinates with vpToPx, undo it so they
+        // are read as fractions of the target box
+        const float unit = vpToPx(1.0);
+        OH_Drawing_CanvasTranslate(canvas, bounds.Left(), bounds.Top());
+        OH_Drawing_CanvasScale(canvas, bounds.Width() / unit, bounds.Height() / unit);
+    }
+    OnDrawTraversed(canvas);
+    LuminanceToAlpha(surface);
+}
+
+} // namespace rnoh
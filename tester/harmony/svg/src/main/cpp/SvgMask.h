@@ -0,0 +1,47 @@
+#pragma once
+#include <native_drawing/drawing_brush.h>
+#include <native_drawing/drawing_sampling_options.h>
+#include <memory>
+#include <vector>
+#include "SvgQuote.h"
+#include "utils/OffscreenSurface.h"
+#include "utils/SvgAttributesParser.h"
+
+namespace rnoh {
+
+class SvgMask : public SvgQuote {
+public:
+    SvgMask();
+    ~SvgMask() override;
+
+    SvgMaskAttribute attr_;
+
+    // Clips to the mask region and opens the layer the masked content is drawn
+    // into, returns false when the region is empty and nothing should be drawn.
+    bool BeginMask(OH_Drawing_Canvas* canvas, const Rect& bounds);
+    // Composites the mask raster, rendered at the target's device scale, onto
+    // the content layer and closes it.
+    void EndMask(OH_Drawing_Canvas* canvas, const Rect& bounds, float scale);
+
+protected:
+    bool HashContent(WideHash& seed) const override;
+
+private:
+    // rasterized mask of one target, in device pixels
+    struct MaskRaster {
+        Rect bounds;
+        float scale;
+        std::unique_ptr<OffscreenSurface> surface;
+    };
+
+    Rect GetMaskRegion(const Rect& bounds) const;
+    OffscreenSurface* GetRaster(const Rect& bounds, const Rect& region, float scale);
+    void RenderRaster(OffscreenSurface& surface, const Rect& bounds, const Rect& region, float scale);
+
+    std::vector<MaskRaster> rasters_;
+    uint64_t rasterGeneration_ = 0;
+    OH_Drawing_Brush* maskBrush_;
+    OH_Drawing_SamplingOptions* sampling_;
+};
+
+} // namespace rnoh
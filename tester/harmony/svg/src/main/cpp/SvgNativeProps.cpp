@@ -0,0 +1,78 @@
+#include "SvgNativeProps.h"
+#include "SvgNode.h"
+#include "properties/SvgDomType.h"
+#include "utils/SvgAttributesParser.h"
+
+namespace rnoh {
+
+namespace {
+const char PROP_MATRIX[] = "matrix";
+
+// RNSVG prop names that differ from the SVG attribute
+const std::pair<const char*, const char*> PROP_NAMES[] = {
+    {"fillOpacity", DOM_SVG_SRC_FILL_OPACITY},
+    {"strokeOpacity", DOM_SVG_SRC_STROKE_OPACITY},
+    {"strokeWidth", DOM_SVG_SRC_STROKE_WIDTH},
+    {"strokeDashoffset", DOM_SVG_SRC_STROKE_DASHOFFSET},
+};
+
+std::string ToAttrName(const std::string& name)
+{
+    for (const auto& [prop, attr] : PROP_NAMES) {
+        if (name == prop) {
+            return attr;
+        }
+    }
+    return name;
+}
+
+void ApplyNativeProp(SvgNode& node, const SvgNativeProp& prop)
+{
+    if (prop.name == PROP_MATRIX) {
+        SvgAnimatedValue current;
+        node.GetAnimatedAttr(DOM_SVG_SRC_TRANSFORM, current);
+        node.SetTransform(prop.numbers);
+        SvgAnimatedValue updated;
+        node.GetAnimatedAttr(DOM_SVG_SRC_TRANSFORM, updated);
+        if (updated.transform != current.transform) {
+            node.MarkDirty();
+        }
+        return;
+    }
+    const auto name = ToAttrName(prop.name);
+    SvgAnimatedValue value;
+    if (!node.GetAnimatedAttr(name, value) || value.kind == SvgAnimatedValue::Kind::TRANSFORM) {
+        // untyped attributes go through the regular parser
+        if (!prop.text.empty()) {
+            node.SetAttr(name, prop.text);
+        }
+        return;
+    }
+    const bool hasNumber = !prop.numbers.empty();
+    if (value.kind == SvgAnimatedValue::Kind::COLOR) {
+        // processColor hands colors over as ARGB numbers, possibly negative
+        value.color = hasNumber ? Color(static_cast<uint32_t>(static_cast<int64_t>(prop.numbers[0])))
+                                : SvgAttributesParser::GetColor(prop.text);
+    } else {
+        value.number = hasNumber ? prop.numbers[0] : SvgAttributesParser::ParseDouble(prop.text);
+    }
+    node.SetAnimatedAttr(name, value);
+}
+} // namespace
+
+bool ApplyNativeProps(SvgContext& context, const std::vector<SvgNativeProp>& props)
+{
+    bool changed = false;
+    for (const auto& prop : props) {
+        auto* node = context.GetSvgNodeByTag(prop.tag);
+        if (!node) {
+            continue;
+        }
+        const auto generation = node->GetGeneration();
+        ApplyNativeProp(*node, prop);
+        changed |= node->GetGeneration() != generation;
+    }
+    return changed;
+}
+
+} // namespace rnoh
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "SvgContext.h"
+
+namespace rnoh {
+
+// One attribute of one node, pushed by an animation driver without a React
+// commit. The node is addressed by the React tag of its component instance.
+struct SvgNativeProp {
+    int32_t tag = 0;
+    // SVG attribute name, RNSVG's camelCase prop names are accepted as well
+    std::string name;
+    // a number, an ARGB color or the six values of matrix
+    std::vector<double> numbers;
+    // used when numbers is empty, parsed like the attribute
+    std::string text;
+};
+
+// Writes a batch into the document's nodes, marking dirty only the nodes
+// whose value changed. Returns whether any did. The caller holds the tree
+// mutex and requests a single redraw for the batch.
+bool ApplyNativeProps(SvgContext& context, const std::vector<SvgNativeProp>& props);
+
+} // namespace rnoh
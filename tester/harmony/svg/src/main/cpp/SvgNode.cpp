@@ -1,8 +1,14 @@
 #include "SvgNode.h"
 #include <native_drawing/drawing_matrix.h>
 #include <native_drawing/drawing_path.h>
+#include "SvgFilter.h"
+#include "SvgMask.h"
+#include "utils/OffscreenSurface.h"
+#include <algorithm>
+#include <atomic>
 #include <regex>
 #include <string>
+#include <typeinfo>
 #include "properties/SvgDomType.h"
 #include "utils/LinearMap.h"
 #include "utils/StringUtils.h"
@@ -14,24 +20,482 @@ namespace {
 constexpr size_t SVG_ATTR_ID_FLAG_NUMS = 6;
 const char VALUE_NONE[] = "none";
 const char ATTR_NAME_OPACITY[] = "opacity";
-const char DOM_SVG_SRC_FILL_OPACITY[] = "fill-opacity";
 const char DOM_SVG_SRC_FILL_RULE[] = "fill-rule";
 const char DOM_SVG_SRC_STROKE_DASHARRAY[] = "stroke-dasharray";
-const char DOM_SVG_SRC_STROKE_DASHOFFSET[] = "stroke-dashoffset";
 const char DOM_SVG_SRC_STROKE_LINECAP[] = "stroke-linecap";
 const char DOM_SVG_SRC_STROKE_LINEJOIN[] = "stroke-linejoin";
 const char DOM_SVG_SRC_STROKE_MITERLIMIT[] = "stroke-miterlimit";
-const char DOM_SVG_SRC_STROKE_OPACITY[] = "stroke-opacity";
-const char DOM_SVG_SRC_STROKE_WIDTH[] = "stroke-width";
 const char DOM_SVG_SRC_CLIP_PATH[] = "clip-path";
 const char DOM_SVG_SRC_CLIP_RULE[] = "clip-rule";
 const char DOM_SVG_SRC_TRANSFORM_ORIGIN[] = "transform-origin";
+
+// CTM versions are unique across all nodes, so a recomputed or new parent
+// never repeats a version a child has seen
+std::atomic<uint64_t> lastCtmVersion{0};
+
+// id referenced by "url(#id)", empty for "none"
+std::string GetUrlId(const std::string& value) {
+  auto id = StringUtils::TrimStr(value);
+  if (id.compare(0, 4, "url(") == 0 && id.back() == ')') {
+    id = StringUtils::TrimStr(id.substr(4, id.size() - 5));
+  }
+  if (!id.empty() && id.front() == '#') {
+    return id.substr(1);
+  }
+  return id == "none" ? "" : id;
+}
 } // namespace
 
+SvgNode::~SvgNode() {
+  if (context_ && nodeId_ != SVG_ID_NONE) {
+    context_->Remove(nodeId_, this);
+  }
+  if (context_ && nativeTag_ != 0) {
+    context_->RemoveTag(nativeTag_, this);
+  }
+  if (transformMatrix_) {
+    OH_Drawing_MatrixDestroy(transformMatrix_);
+  }
+}
+
+void SvgNode::SetTransform(const AffineTransform& transform) {
+  if (transform == matrixTransform_) {
+    return;
+  }
+  matrixTransform_ = transform;
+  UpdateTransform();
+}
+
+bool SvgNode::ApplyTransform(const AffineTransform& transform) {
+  if (transform == transform_) {
+    return false;
+  }
+  transform_ = transform;
+  ++transformGeneration_;
+  if (transform_.IsTranslateOnly()) {
+    return true;
+  }
+  if (!transformMatrix_) {
+    transformMatrix_ = OH_Drawing_MatrixCreate();
+  }
+  OH_Drawing_MatrixSetMatrix(
+      transformMatrix_,
+      transform_.a,
+      transform_.c,
+      transform_.e,
+      transform_.b,
+      transform_.d,
+      transform_.f,
+      0,
+      0,
+      1);
+  return true;
+}
+
+void SvgNode::SetTransformAttr(const std::string& value) {
+  if (value == attributes_.transform) {
+    return;
+  }
+  attributes_.transform = value;
+  if (!ParseTransformList(value, transformAttr_)) {
+    LOG(WARNING) << "[SVGNode] invalid transform: " << value;
+  }
+  // lengths of the list are in user units, the canvas works in px
+  transformAttr_.e = vpToPx(transformAttr_.e);
+  transformAttr_.f = vpToPx(transformAttr_.f);
+  UpdateTransform();
+}
+
+void SvgNode::SetTransformOrigin(const std::string& value) {
+  if (value == attributes_.transformOrigin) {
+    return;
+  }
+  attributes_.transformOrigin = value;
+  hasTransformOrigin_ = ParseTransformOrigin(value, transformOrigin_);
+  UpdateTransform();
+}
+
+void SvgNode::RefreshTransformOrigins() {
+  if (hasTransformOrigin_) {
+    UpdateTransform();
+  }
+  for (auto& child : children_) {
+    child->RefreshTransformOrigins();
+  }
+}
+
+void SvgNode::UpdateTransform() {
+  if (!hasTransformOrigin_ || transformAttr_.IsIdentity()) {
+    if (ApplyTransform(matrixTransform_ * transformAttr_)) {
+      MarkDirty();
+    }
+    return;
+  }
+  Size viewPort;
+  if (context_) {
+    const auto& viewBox = context_->GetRootViewBox();
+    viewPort = Size(vpToPx(viewBox.Width()), vpToPx(viewBox.Height()));
+  }
+  auto resolve = [](const Dimension& value, double length) {
+    return value.Unit() == DimensionUnit::PERCENT ? value.Value() * length
+                                                  : vpToPx(value.Value());
+  };
+  const double x = resolve(transformOrigin_.x, viewPort.Width());
+  const double y = resolve(transformOrigin_.y, viewPort.Height());
+  if (ApplyTransform(
+          matrixTransform_ * AffineTransform::Translate(x, y) *
+          transformAttr_ * AffineTransform::Translate(-x, -y))) {
+    MarkDirty();
+  }
+}
+
+void SvgNode::CollectNodes(std::vector<SvgNode*>& nodes) {
+  nodes.push_back(this);
+  for (const auto& child : children_) {
+    child->CollectNodes(nodes);
+  }
+}
+
+WideHash SvgNode::GetContentHash() {
+  if (contentHashGeneration_ == generation_) {
+    return contentHash_;
+  }
+  WideHash seed;
+  HashCombine(seed, std::string_view(typeid(*this).name()));
+  if (!HashContent(seed)) {
+    HashCombine(seed, reinterpret_cast<uintptr_t>(this));
+  }
+  for (double value : {transform_.a, transform_.b, transform_.c, transform_.d, transform_.e, transform_.f}) {
+    HashCombine(seed, value);
+  }
+  HashCombine(seed, opacity_);
+  const auto& fill = attributes_.fillState;
+  HashCombine(seed, fill.GetColor().GetValue());
+  HashCombine(seed, fill.GetOpacity());
+  HashCombine(seed, fill.GetFillRule());
+  const auto& stroke = attributes_.strokeState;
+  HashCombine(seed, stroke.GetColor().GetValue());
+  HashCombine(seed, stroke.GetOpacity());
+  HashCombine(seed, stroke.GetLineWidth().Value());
+  HashCombine(seed, static_cast<int>(stroke.GetLineCap()));
+  HashCombine(seed, static_cast<int>(stroke.GetLineJoin()));
+  HashCombine(seed, stroke.GetMiterLimit());
+  for (double dash : stroke.GetLineDash().lineDash) {
+    HashCombine(seed, dash);
+  }
+  HashCombine(seed, stroke.GetLineDash().dashOffset);
+  HashRef(seed, nodeId_);
+  HashRef(seed, hrefClipPath_);
+  HashRef(seed, hrefMaskId_);
+  HashRef(seed, hrefFilter_);
+  HashRef(seed, attributes_.href);
+  for (const auto& child : children_) {
+    HashCombine(seed, child->GetContentHash());
+  }
+  contentHash_ = seed;
+  contentHashGeneration_ = generation_;
+  return contentHash_;
+}
+
+void SvgNode::HashRef(WideHash& seed, SvgIdHandle handle) const {
+  if (handle != SVG_ID_NONE && context_) {
+    HashCombine(seed, context_->GetIdString(handle));
+  }
+}
+
+const AffineTransform& SvgNode::GetCtm() {
+  uint64_t parentVersion = 0;
+  if (parent_) {
+    parent_->GetCtm();
+    parentVersion = parent_->ctmVersion_;
+  }
+  if (ctmVersion_ == 0 || ctmParentVersion_ != parentVersion ||
+      ctmTransformGeneration_ != transformGeneration_) {
+    ctm_ = parent_ ? parent_->ctm_ * transform_ : transform_;
+    ctmParentVersion_ = parentVersion;
+    ctmTransformGeneration_ = transformGeneration_;
+    ctmVersion_ = ++lastCtmVersion;
+  }
+  return ctm_;
+}
+
+float SvgNode::GetDeviceScaleBucket() {
+  const float deviceScale = context_ ? context_->GetDeviceScale() : 1.0f;
+  return ScaleBucket(deviceScale * GetCtm().GetMaxScale());
+}
+
+void SvgNode::SetContext(const std::shared_ptr<SvgContext>& context) {
+  if (context_ == context) {
+    return;
+  }
+  if (context_ && nodeId_ != SVG_ID_NONE) {
+    pendingId_ = context_->GetIdString(nodeId_);
+    context_->Remove(nodeId_, this);
+    nodeId_ = SVG_ID_NONE;
+  }
+  if (context_ && nativeTag_ != 0) {
+    context_->RemoveTag(nativeTag_, this);
+  }
+  if (context_) {
+    // handles are only meaningful in the context that interned them
+    for (auto* slot : boundRefs_) {
+      if (*slot != SVG_ID_NONE) {
+        pendingRefs_.emplace_back(slot, context_->GetIdString(*slot));
+        *slot = SVG_ID_NONE;
+      }
+    }
+    boundRefs_.clear();
+  }
+  context_ = context;
+  if (context_) {
+    if (nativeTag_ != 0) {
+      context_->PushTag(nativeTag_, this);
+    }
+    if (!pendingId_.empty()) {
+      nodeId_ = context_->Intern(pendingId_);
+      context_->Push(nodeId_, this);
+      pendingId_.clear();
+    }
+    for (auto& [slot, id] : pendingRefs_) {
+      *slot = context_->Intern(id);
+      boundRefs_.push_back(slot);
+    }
+    pendingRefs_.clear();
+  }
+  if (hasTransformOrigin_) {
+    // percentages resolve against the new document's viewBox
+    UpdateTransform();
+  }
+  OnSetContext();
+  for (auto& child : children_) {
+    child->SetContext(context_);
+  }
+}
+
+bool SvgNode::GetAnimatedAttr(const std::string& name, SvgAnimatedValue& value) const {
+  if (name == DOM_SVG_SRC_TRANSFORM) {
+    value.kind = SvgAnimatedValue::Kind::TRANSFORM;
+    value.transform = transform_;
+    return true;
+  }
+  if (name == DOM_SVG_OPACITY) {
+    return GetAnimatedField(opacity_ / static_cast<double>(UINT8_MAX), value);
+  }
+  return false;
+}
+
+bool SvgNode::SetAnimatedAttr(const std::string& name, const SvgAnimatedValue& value) {
+  if (name == DOM_SVG_SRC_TRANSFORM && value.kind == SvgAnimatedValue::Kind::TRANSFORM) {
+    // animated values replace the composed transform until the next tick
+    if (ApplyTransform(value.transform)) {
+      MarkDirty();
+    }
+    return true;
+  }
+  if (name == DOM_SVG_OPACITY && value.kind == SvgAnimatedValue::Kind::NUMBER) {
+    SetOpacity(value.number);
+    return true;
+  }
+  return false;
+}
+
+void SvgNode::SetOpacity(double opacity) {
+  const auto alpha = static_cast<uint8_t>(std::clamp(opacity, 0.0, 1.0) * UINT8_MAX + 0.5);
+  if (alpha != opacity_) {
+    opacity_ = alpha;
+    MarkDirty();
+  }
+}
+
+void SvgNode::InsertChild(const std::shared_ptr<SvgNode>& child, size_t index) {
+  if (!child || child.get() == this) {
+    return;
+  }
+  // the caller's reference may be the slot erased below
+  auto node = child;
+  if (node->parent_) {
+    node->parent_->DetachChild(node);
+  }
+  node->parent_ = this;
+  node->ctmVersion_ = 0;
+  children_.insert(children_.begin() + std::min(index, children_.size()), node);
+  if (context_) {
+    context_->MarkStructureChanged();
+  }
+  MarkDirty();
+  OnAppendChild(node);
+  node->SetContext(context_);
+}
+
+void SvgNode::RemoveChild(const std::shared_ptr<SvgNode>& child) {
+  if (!child || child->parent_ != this) {
+    return;
+  }
+  auto node = child;
+  DetachChild(node);
+  node->SetContext(nullptr);
+}
+
+void SvgNode::DetachChild(const std::shared_ptr<SvgNode>& child) {
+  auto item = std::find(children_.begin(), children_.end(), child);
+  if (item == children_.end()) {
+    return;
+  }
+  children_.erase(item);
+  MarkDirty();
+  child->parent_ = nullptr;
+  child->ctmVersion_ = 0;
+  if (context_) {
+    context_->MarkStructureChanged();
+  }
+  OnRemoveChild(child);
+}
+
+void SvgNode::MarkDirty() {
+  for (auto* node = this; node; node = node->parent_) {
+    ++node->generation_;
+  }
+}
+
+uint64_t SvgNode::GetReferencedGeneration() {
+  uint64_t generation = GetHrefGeneration(hrefClipPath_) + GetHrefGeneration(hrefMaskId_) +
+      GetHrefGeneration(hrefFilter_);
+  for (auto& child : children_) {
+    generation += child->GetReferencedGeneration();
+  }
+  return generation;
+}
+
+uint64_t SvgNode::GetHrefGeneration(SvgIdHandle handle) {
+  auto* node = context_ && handle != SVG_ID_NONE ? context_->GetSvgNodeByHandle(handle) : nullptr;
+  if (!node || node->summingReferences_) {
+    return 0;
+  }
+  node->summingReferences_ = true;
+  const uint64_t generation = node->generation_ + node->GetReferencedGeneration();
+  node->summingReferences_ = false;
+  return generation;
+}
+
+Rect SvgNode::AsBounds() {
+  Rect bounds;
+  for (auto& child : children_) {
+    if (!child || !child->drawTraversed_) {
+      continue;
+    }
+    auto childBounds = child->transform_.MapRect(child->AsBounds());
+    if (!childBounds.IsValid()) {
+      continue;
+    }
+    bounds = bounds.IsValid() ? bounds.CombineRect(childBounds) : childBounds;
+  }
+  return bounds;
+}
+
+double SvgNode::GetPaintOutset() {
+  // a blur reaches about three sigma past the edge
+  double outset = 3.0 * GetSmoothEdge();
+  for (auto& child : children_) {
+    if (child && child->drawTraversed_) {
+      outset = std::max(outset, child->GetPaintOutset() * child->transform_.GetMaxScale());
+    }
+  }
+  return outset;
+}
+
+void SvgNode::DrawRecorded(OH_Drawing_Canvas* canvas) {
+  // content drawn through href changes without bumping generation_
+  const uint64_t generation = generation_ + GetReferencedGeneration();
+  if (recordedGeneration_ != generation) {
+    recordedGeneration_ = generation;
+    recorded_.reset();
+    auto bounds = AsBounds();
+    if (bounds.IsValid()) {
+      // geometric bounds leave out strokes and markers, Draw() applies
+      // transform_ on top
+      const double padding = std::ceil(GetPaintOutset()) + 1.0;
+      bounds = transform_.MapRect(Rect(
+          bounds.Left() - padding,
+          bounds.Top() - padding,
+          bounds.Width() + 2 * padding,
+          bounds.Height() + 2 * padding));
+      const uint64_t incomplete = context_ ? context_->GetIncompleteCount() : 0;
+      recorded_ = SvgPicture::Record(
+          bounds, [this](OH_Drawing_Canvas* recordingCanvas) { Draw(recordingCanvas); });
+      if (context_ && context_->GetIncompleteCount() != incomplete) {
+        // recorded with content missing, record again on the next draw
+        recordedGeneration_ = 0;
+      }
+    }
+  }
+  if (recorded_) {
+    recorded_->Draw(canvas);
+  }
+}
+
+void SvgNode::SetId(const std::string& id) {
+  if (!context_) {
+    pendingId_ = id;
+    return;
+  }
+  auto handle = context_->Intern(id);
+  if (handle == nodeId_) {
+    return;
+  }
+  if (nodeId_ != SVG_ID_NONE) {
+    context_->Remove(nodeId_, this);
+  }
+  nodeId_ = handle;
+  context_->Push(nodeId_, this);
+}
+
+void SvgNode::SetNativeTag(int32_t tag) {
+  if (context_ && nativeTag_ != 0) {
+    context_->RemoveTag(nativeTag_, this);
+  }
+  nativeTag_ = tag;
+  if (context_ && nativeTag_ != 0) {
+    context_->PushTag(nativeTag_, this);
+  }
+}
+
+void SvgNode::BindRef(SvgIdHandle& slot, const std::string& id) {
+  if (context_) {
+    slot = context_->Intern(id);
+    if (std::find(boundRefs_.begin(), boundRefs_.end(), &slot) == boundRefs_.end()) {
+      boundRefs_.push_back(&slot);
+    }
+    return;
+  }
+  for (auto it = pendingRefs_.begin(); it != pendingRefs_.end(); ++it) {
+    if (it->first == &slot) {
+      pendingRefs_.erase(it);
+      break;
+    }
+  }
+  slot = SVG_ID_NONE;
+  if (!id.empty()) {
+    pendingRefs_.emplace_back(&slot, id);
+  }
+}
+
 void SvgNode::SetAttr(const std::string& name, const std::string& value) {
   if (ParseAndSetSpecializedAttr(name, value)) {
     return;
   }
+  if (name == DOM_SVG_SRC_TRANSFORM) {
+    SetTransformAttr(value);
+    return;
+  }
+  if (name == DOM_SVG_SRC_TRANSFORM_ORIGIN) {
+    SetTransformOrigin(value);
+    return;
+  }
+  if (name == DOM_SVG_FILTER) {
+    SetFilterRef(GetUrlId(value));
+    MarkDirty();
+    return;
+  }
   static LinearMapNode<void (*)(const std::string&, SvgBaseAttribute&)> SVG_BASE_ATTRS[] = {
       //                 { DOM_SVG_SRC_CLIP_PATH,
       //                     [](const std::string& val, SvgBaseAttribute&
@@ -332,6 +796,9 @@ void SvgNode::InitStyle(const SvgBaseAttribute& attr) {
 void SvgNode::OnDrawTraversed(OH_Drawing_Canvas* canvas) {
   auto smoothEdge = GetSmoothEdge();
   for (auto& node : children_) {
+    if (context_ && context_->ShouldYield()) {
+      return;
+    }
     if (node && node->drawTraversed_) {
       if (GreatNotEqual(smoothEdge, 0.0f)) {
         node->SetSmoothEdge(smoothEdge);
@@ -342,39 +809,37 @@ void SvgNode::OnDrawTraversed(OH_Drawing_Canvas* canvas) {
 }
 
 void SvgNode::OnClipPath(OH_Drawing_Canvas* canvas) {
-  auto refSvgNode = context_->GetSvgNodeById(hrefClipPath_);
+  auto* refSvgNode = context_->GetSvgNodeByHandle(hrefClipPath_);
   if (!refSvgNode) {
     return;
   };
-  auto* clipPath = refSvgNode->AsPath();
+  auto* clipPath = refSvgNode->CopyPath();
+  if (!clipPath) {
+    return;
+  }
   OH_Drawing_CanvasClipPath(
       canvas, clipPath, OH_Drawing_CanvasClipOp::INTERSECT, true);
   OH_Drawing_PathDestroy(clipPath);
 }
 
-void SvgNode::OnMask(OH_Drawing_Canvas* canvas) {
-  auto refMask = context_->GetSvgNodeById(hrefMaskId_);
+SvgMask* SvgNode::OnMask(OH_Drawing_Canvas* canvas, Rect& bounds) {
+  auto* refMask = dynamic_cast<SvgMask*>(context_->GetSvgNodeByHandle(hrefMaskId_));
   if (!refMask) {
-    return;
-  };
-  refMask->Draw(canvas);
+    return nullptr;
+  }
+  bounds = AsBounds();
+  if (!refMask->BeginMask(canvas, bounds)) {
+    return nullptr;
+  }
+  return refMask;
 }
 
 void SvgNode::OnTransform(OH_Drawing_Canvas* canvas) {
-  auto* matrix = OH_Drawing_MatrixCreate();
-  OH_Drawing_MatrixSetMatrix(
-      matrix,
-      transform_[0],
-      transform_[1],
-      transform_[2],
-      transform_[3],
-      transform_[4],
-      transform_[5],
-      transform_[6],
-      transform_[7],
-      transform_[8]);
-  OH_Drawing_CanvasConcatMatrix(canvas, matrix);
-  OH_Drawing_MatrixDestroy(matrix);
+  if (transform_.IsTranslateOnly()) {
+    OH_Drawing_CanvasTranslate(canvas, transform_.e, transform_.f);
+    return;
+  }
+  OH_Drawing_CanvasConcatMatrix(canvas, transformMatrix_);
 }
 
 double SvgNode::ConvertDimensionToPx(
@@ -407,18 +872,34 @@ void SvgNode::Draw(OH_Drawing_Canvas* canvas) {
   // mask and filter create extra layers, need to record initial layer count
   const auto count = OH_Drawing_CanvasGetSaveCount(canvas);
   OH_Drawing_CanvasSave(canvas);
-  if (!hrefClipPath_.empty()) {
+  if (hrefClipPath_ != SVG_ID_NONE) {
     OnClipPath(canvas);
   }
-  if (!transform_.empty()) {
+  if (!transform_.IsIdentity()) {
     OnTransform(canvas);
   }
-  if (!hrefMaskId_.empty()) {
-    OnMask(canvas);
+  SvgMask* mask = nullptr;
+  Rect maskBounds;
+  if (hrefMaskId_ != SVG_ID_NONE) {
+    mask = OnMask(canvas, maskBounds);
   }
 
-  OnDraw(canvas);
-  OnDrawTraversed(canvas);
+  auto* filter = hrefFilter_ != SVG_ID_NONE
+      ? dynamic_cast<SvgFilter*>(context_->GetSvgNodeByHandle(hrefFilter_))
+      : nullptr;
+  if (filter) {
+    filter->DrawFiltered(
+        canvas, *this, AsBounds(), GetDeviceScaleBucket(), [this](OH_Drawing_Canvas* content) {
+          OnDraw(content);
+          OnDrawTraversed(content);
+        });
+  } else {
+    OnDraw(canvas);
+    OnDrawTraversed(canvas);
+  }
+  if (mask) {
+    mask->EndMask(canvas, maskBounds, GetDeviceScaleBucket());
+  }
   OH_Drawing_CanvasRestoreToCount(canvas, count);
 };
 } // namespace rnoh
\ No newline at end of file
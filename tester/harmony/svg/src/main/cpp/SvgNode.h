@@ -3,37 +3,108 @@
 
 #include <glog/logging.h>
 #include <native_drawing/drawing_canvas.h>
+#include <native_drawing/drawing_matrix.h>
 #include <memory>
 #include <vector>
 #include "SvgBaseAttribute.h"
 #include "SvgContext.h"
+#include "properties/AffineTransform.h"
+#include "utils/TransformParser.h"
 #include "properties/Dimension.h"
+#include "properties/Rect.h"
 #include "properties/Size.h"
+#include "utils/SvgPicture.h"
 
 namespace rnoh {
 
+class SvgMask;
+struct SvgDrawRecord;
+
+// Value SvgAnimate writes into a node: a number in user units, a color or a
+// whole transform with e/f in px like transform_.
+struct SvgAnimatedValue {
+  enum class Kind {
+    NUMBER,
+    COLOR,
+    TRANSFORM,
+  };
+  Kind kind = Kind::NUMBER;
+  double number = 0.0;
+  Color color;
+  AffineTransform transform;
+};
+
 enum class SvgLengthType {
   HORIZONTAL,
   VERTICAL,
   OTHER,
 };
 
-class SvgNode {
+class SvgNode : public std::enable_shared_from_this<SvgNode> {
  public:
   SvgNode() = default;
-  virtual ~SvgNode() = default;
+  virtual ~SvgNode();
 
   std::shared_ptr<SvgContext> GetContext() {
     return context_;
   }
-  void SetContext(std::shared_ptr<SvgContext> context) {
-    context_ = context;
+  // Attaches the subtree to a document, interning ids that were set before
+  // the node was inserted.
+  void SetContext(const std::shared_ptr<SvgContext>& context);
+
+  void SetId(const std::string& id);
+  // React tag of the component instance owning the node, 0 for none.
+  void SetNativeTag(int32_t tag);
+  void SetClipPathRef(const std::string& id) {
+    BindRef(hrefClipPath_, id);
+  }
+  void SetMaskRef(const std::string& id) {
+    BindRef(hrefMaskId_, id);
+  }
+  // opacity prop, 0 to 1, scaling fill and stroke alike
+  void SetOpacity(double opacity);
+  void SetFilterRef(const std::string& id) {
+    BindRef(hrefFilter_, id);
+  }
+  void SetHref(const std::string& id) {
+    BindRef(attributes_.href, id);
   }
 
   void InitStyle(const SvgBaseAttribute& attr);
 
+  // Transform from the matrix prop, composed with the transform attribute.
+  void SetTransform(const AffineTransform& transform);
+  // matrix prop of RNSVG: [a b c d e f] with e/f in user units
+  template <typename T>
+  void SetTransform(const std::vector<T>& matrix) {
+    if (matrix.size() < 6) {
+      SetTransform(AffineTransform());
+      return;
+    }
+    SetTransform(AffineTransform{
+        matrix[0], matrix[1], matrix[2], matrix[3], vpToPx(matrix[4]), vpToPx(matrix[5])});
+  }
+
+  // SVG transform attribute and transform-origin, both re-parsed only when
+  // their string changes so animated values do not allocate per frame.
+  void SetTransformAttr(const std::string& value);
+  void SetTransformOrigin(const std::string& value);
+  // Re-resolves percent transform-origins of the subtree, called once the
+  // root viewBox they are relative to was resized.
+  void RefreshTransformOrigins();
+
+  // Transform from this node's user space to the root's, recomputed only
+  // when a transform on the ancestor chain changed.
+  const AffineTransform& GetCtm();
+  // Device scale of this node's user space, bucketed for raster caches.
+  float GetDeviceScaleBucket();
+
   virtual void Draw(OH_Drawing_Canvas* canvas);
 
+  // Draws the node from a recording of its subtree. The recording is shared
+  // by every <use> of the node and redone only when the subtree changes.
+  void DrawRecorded(OH_Drawing_Canvas* canvas);
+
   virtual void SetAttr(const std::string& name, const std::string& value);
 
   virtual bool ParseAndSetSpecializedAttr(
@@ -42,13 +113,63 @@ class SvgNode {
     return false;
   }
 
+  // Typed access for declarative animations, by SVG attribute name. False
+  // when the node does not animate name; setting marks the node dirty only
+  // when the value changed.
+  virtual bool GetAnimatedAttr(const std::string& name, SvgAnimatedValue& value) const;
+  virtual bool SetAnimatedAttr(const std::string& name, const SvgAnimatedValue& value);
+
   virtual OH_Drawing_Path* AsPath() const {
     LOG(INFO) << "[SVGNode] AsPath";
+    return nullptr;
   };
+  // Outline in user units owned by the caller, nullptr for nodes without
+  // one. Unlike AsPath() it never hands out a path the node keeps.
+  virtual OH_Drawing_Path* CopyPath() {
+    return nullptr;
+  }
+
+  // Bounding box in user space, the union of the children by default.
+  virtual Rect AsBounds();
+  // How far painting reaches past AsBounds() in px of the same space: stroke
+  // joins and caps, markers, blurred edges. The children's by default.
+  virtual double GetPaintOutset();
+  // Own transform, user space to the parent's, e/f in px.
+  const AffineTransform& GetTransform() const {
+    return transform_;
+  }
+
+  void AppendChild(const std::shared_ptr<SvgNode>& child) {
+    InsertChild(child, children_.size());
+  }
+  // Puts child at index, or last when index is past the end. A child that
+  // already has a parent is moved, it joins this node's document.
+  void InsertChild(const std::shared_ptr<SvgNode>& child, size_t index);
+  // Detaches child, which leaves the document: its id, tag and animations
+  // are unregistered until it is inserted again.
+  void RemoveChild(const std::shared_ptr<SvgNode>& child);
 
-  virtual void AppendChild(const std::shared_ptr<SvgNode>& child) {
-    children_.emplace_back(child);
+  // Bumps the generation of this node and its ancestors, caches built from
+  // a subtree compare their stored generation against it.
+  void MarkDirty();
+  uint64_t GetGeneration() const {
+    return generation_;
   }
+  // Sum of the generations of the nodes the subtree draws through href,
+  // such as the element a <use> instances, clips, masks and paint servers.
+  // It grows whenever one of them changes, so caches of a subtree key on it
+  // next to GetGeneration().
+  virtual uint64_t GetReferencedGeneration();
+
+  // Geometry work of this node alone, done ahead of drawing. Implementations
+  // touch only the node's own state, as nodes are prepared concurrently.
+  virtual void PrepareGeometry() {}
+  // Appends this node and its descendants in draw order.
+  void CollectNodes(std::vector<SvgNode*>& nodes);
+
+  // Hash of what the subtree draws, equal for subtrees that render the same
+  // pixels. Recomputed only after the subtree changed.
+  WideHash GetContentHash();
 
  protected:
   virtual void InheritAttr(const SvgBaseAttribute& parent) {
@@ -60,15 +181,52 @@ class SvgNode {
   }
 
   // override as need by derived class
-  // called by function AppendChild
+  // called by function InsertChild once child is in children_
   virtual void OnAppendChild(const std::shared_ptr<SvgNode>& child) {}
+  // called once child left children_, before it leaves the document
+  virtual void OnRemoveChild(const std::shared_ptr<SvgNode>& child) {}
   // called by function InitStyle
   virtual void OnInitStyle() {}
+  // called by function SetContext once context_ changed
+  virtual void OnSetContext() {}
+
+  // numeric fields exposed through Get/SetAnimatedAttr
+  template <typename T>
+  static bool GetAnimatedField(const T& field, SvgAnimatedValue& value) {
+    value.kind = SvgAnimatedValue::Kind::NUMBER;
+    value.number = field;
+    return true;
+  }
+  template <typename T>
+  bool SetAnimatedField(T& field, const SvgAnimatedValue& value) {
+    if (value.kind != SvgAnimatedValue::Kind::NUMBER) {
+      return false;
+    }
+    const auto number = static_cast<T>(value.number);
+    if (field != number) {
+      field = number;
+      MarkDirty();
+    }
+    return true;
+  }
 
   virtual void OnDraw(OH_Drawing_Canvas* canvas) {}
   virtual void OnDrawTraversed(OH_Drawing_Canvas* canvas);
+  // Lets SvgDrawList paint the node without Draw(): sets record.op and, for
+  // shapes, the handles it draws with. Called again after every change of
+  // the node; false keeps the node on Draw().
+  virtual bool PrepareFlatDraw(SvgDrawRecord& record) {
+    return false;
+  }
+  // clip path, mask, filter or blurred edges, which only Draw() applies
+  bool HasDrawEffects() const {
+    return hrefClipPath_ != SVG_ID_NONE || hrefMaskId_ != SVG_ID_NONE || hrefFilter_ != SVG_ID_NONE ||
+        smoothEdge_ > 0.0f;
+  }
   void OnClipPath(OH_Drawing_Canvas* canvas);
-  void OnMask(OH_Drawing_Canvas* canvas);
+  // Opens the mask layers and returns the referenced mask, bounds receives
+  // the box the mask was opened with.
+  SvgMask* OnMask(OH_Drawing_Canvas* canvas, Rect& bounds);
   void OnTransform(OH_Drawing_Canvas* canvas);
 
   void SetSmoothEdge(float edge) {
@@ -78,6 +236,27 @@ class SvgNode {
     return smoothEdge_;
   }
 
+  // Stores the handle of id in slot, deferred until a context is attached.
+  void BindRef(SvgIdHandle& slot, const std::string& id);
+
+  // Mixes the node's own geometry into seed. Nodes that do not describe their
+  // content return false and are hashed by identity, so they never share.
+  virtual bool HashContent(WideHash& seed) const {
+    return false;
+  }
+  // mixes the id a handle refers to, handles differ between documents
+  void HashRef(WideHash& seed, SvgIdHandle handle) const;
+  static void HashRect(WideHash& seed, const Rect& rect) {
+    HashCombine(seed, rect.Left());
+    HashCombine(seed, rect.Top());
+    HashCombine(seed, rect.Width());
+    HashCombine(seed, rect.Height());
+  }
+  static void HashDimension(WideHash& seed, const Dimension& value) {
+    HashCombine(seed, value.Value());
+    HashCombine(seed, static_cast<int>(value.Unit()));
+  }
+
   double ConvertDimensionToPx(
       const Dimension& value,
       const Size& viewPort,
@@ -85,13 +264,25 @@ class SvgNode {
 
   SvgBaseAttribute attributes_;
   std::shared_ptr<SvgContext> context_;
+  SvgNode* parent_ = nullptr; // owns this node through children_
+  // Written only on the UI thread with the tree mutex held; preparing a frame
+  // never writes it.
+  uint64_t generation_ = 1;
 
   std::vector<std::shared_ptr<SvgNode>> children_;
-  std::string nodeId_;
-  std::vector<float> transform_; // transform matrix
+  SvgIdHandle nodeId_ = SVG_ID_NONE;
+  int32_t nativeTag_ = 0;
+  AffineTransform transform_;
+  // transform_ as a drawing matrix, built when the transform changes
+  OH_Drawing_Matrix* transformMatrix_ = nullptr;
+  uint64_t transformGeneration_ = 0;
 
-  std::string hrefClipPath_;
-  std::string hrefMaskId_;
+  SvgIdHandle hrefClipPath_ = SVG_ID_NONE;
+  SvgIdHandle hrefMaskId_ = SVG_ID_NONE;
+  SvgIdHandle hrefFilter_ = SVG_ID_NONE;
+  // Generation of the node behind handle and of what it references in turn,
+  // 0 for none or for a node already being summed up (reference cycles).
+  uint64_t GetHrefGeneration(SvgIdHandle handle);
   std::string imagePath_;
   float smoothEdge_ = 0.0f;
   uint8_t opacity_ = 0xFF;
@@ -105,6 +296,40 @@ class SvgNode {
                              // mask/defs/pattern/filter = false
   bool drawTraversed_ =
       true; // enable OnDraw, TAGS mask/defs/pattern/filter = false
+
+ private:
+  friend class SvgDrawList;
+
+  AffineTransform ctm_;
+  uint64_t ctmVersion_ = 0; // 0 while ctm_ was never computed
+  uint64_t ctmParentVersion_ = 0;
+  uint64_t ctmTransformGeneration_ = 0;
+
+  // Sets transform_, false when it did not change.
+  bool ApplyTransform(const AffineTransform& transform);
+  // Composes matrixTransform_ with the transform attribute about its origin.
+  void UpdateTransform();
+
+  AffineTransform matrixTransform_;
+  AffineTransform transformAttr_;
+  TransformOrigin transformOrigin_;
+  bool hasTransformOrigin_ = false;
+
+  WideHash contentHash_;
+  uint64_t contentHashGeneration_ = 0;
+
+  std::shared_ptr<SvgPicture> recorded_;
+  // generation_ plus GetReferencedGeneration() when recorded_ was made
+  uint64_t recordedGeneration_ = 0;
+  bool summingReferences_ = false;
+
+  // ids set before the node joined a document
+  std::string pendingId_;
+  std::vector<std::pair<SvgIdHandle*, std::string>> pendingRefs_;
+  // slots interned in context_, turned back into pendingRefs_ on leaving it
+  std::vector<SvgIdHandle*> boundRefs_;
+
+  void DetachChild(const std::shared_ptr<SvgNode>& child);
 };
 
 } // namespace rnoh
@@ -1,3 +1,4 @@
+#pragma once
 #include "SvgGraphic.h"
 #include <native_drawing/drawing_point.h>
 namespace rnoh {
@@ -6,11 +7,24 @@ public:
     SvgPath() = default;
     ~SvgPath() override = default;
     // onProps changed 进行修改
-    std::string d;
     uint32_t colorFill;
-    void OnDraw(OH_Drawing_Canvas *canvas) override;
+    // Stores d, it is parsed once per change when the frame is prepared.
+    void SetD(const std::string &d);
     OH_Drawing_Path *AsPath() const override;
+    const PathData *AsPathData() override { return &GetPathData(); }
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        HashCombine(seed, d_);
+        return SvgGraphic::HashContent(seed);
+    }
+
 private:
+    const PathData &GetPathData() const;
+
+    std::string d_;
+    mutable PathData pathData_;
+    mutable bool pathDataValid_ = true;
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
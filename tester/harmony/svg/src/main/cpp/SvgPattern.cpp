@@ -0,0 +1,141 @@
+#include "SvgPattern.h"
+#include <native_drawing/drawing_matrix.h>
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+namespace {
+// shapes filled with the same pattern at different sizes or zoom levels
+constexpr size_t MAX_CACHED_TILES = 4;
+// a tile larger than this is rendered at a lower scale and stretched
+constexpr double MAX_TILE_SIZE = 2048.0;
+} // namespace
+
+SvgPattern::SvgPattern() : SvgQuote()
+{
+    sampling_ = OH_Drawing_SamplingOptionsCreate(FILTER_MODE_LINEAR, MIPMAP_MODE_NONE);
+}
+
+SvgPattern::~SvgPattern()
+{
+    ClearTiles();
+    OH_Drawing_SamplingOptionsDestroy(sampling_);
+}
+
+void SvgPattern::ClearTiles()
+{
+    for (auto& tile : tiles_) {
+        OH_Drawing_ShaderEffectDestroy(tile.shader);
+    }
+    tiles_.clear();
+}
+
+bool SvgPattern::DependsOnBounds() const
+{
+    return attr_.patternUnits == "objectBoundingBox" ||
+           (attr_.patternContentUnits == "objectBoundingBox" && !attr_.viewBox.IsValid());
+}
+
+double SvgPattern::GetTransformScale() const
+{
+    if (patternMatrix_.size() < 6) {
+        return 1.0;
+    }
+    return std::max(std::hypot(patternMatrix_[0], patternMatrix_[1]), std::hypot(patternMatrix_[2], patternMatrix_[3]));
+}
+
+bool SvgPattern::HashContent(WideHash& seed) const
+{
+    HashDimension(seed, attr_.x);
+    HashDimension(seed, attr_.y);
+    HashDimension(seed, attr_.width);
+    HashDimension(seed, attr_.height);
+    HashCombine(seed, attr_.patternUnits);
+    HashCombine(seed, attr_.patternContentUnits);
+    HashRect(seed, attr_.viewBox);
+    HashCombine(seed, align_);
+    HashCombine(seed, static_cast<int>(meetOrSlice_));
+    for (double value : patternMatrix_) {
+        HashCombine(seed, value);
+    }
+    return true;
+}
+
+OH_Drawing_ShaderEffect* SvgPattern::GetShader(const Rect& bounds, float scale)
+{
+    if (tileGeneration_ != generation_) {
+        ClearTiles();
+        tileGeneration_ = generation_;
+    }
+    // shapes sharing a userSpaceOnUse pattern share its tiles
+    const Rect key = DependsOnBounds() ? bounds : Rect();
+    for (auto& tile : tiles_) {
+        if (tile.scale == scale && IsSameBounds(tile.bounds, key)) {
+            return tile.shader;
+        }
+    }
+    const auto tile = ResolveRegion(attr_.x, attr_.y, attr_.width, attr_.height,
+                                    attr_.patternUnits == "objectBoundingBox", bounds);
+    if (!tile.IsValid()) {
+        return nullptr;
+    }
+    const double tileScale =
+        std::min(scale * GetTransformScale(), MAX_TILE_SIZE / std::max(tile.Width(), tile.Height()));
+    auto surface = std::make_unique<OffscreenSurface>(static_cast<uint32_t>(std::ceil(tile.Width() * tileScale)),
+                                                      static_cast<uint32_t>(std::ceil(tile.Height() * tileScale)));
+    if (!surface->IsValid()) {
+        return nullptr;
+    }
+    RenderTile(*surface, bounds, tile);
+    auto* shader = CreateShader(*surface, tile);
+    if (tiles_.size() >= MAX_CACHED_TILES) {
+        OH_Drawing_ShaderEffectDestroy(tiles_.front().shader);
+        tiles_.erase(tiles_.begin());
+    }
+    tiles_.push_back({key, scale, std::move(surface), shader});
+    return shader;
+}
+
+void SvgPattern::RenderTile(OffscreenSurface& surface, const Rect& bounds, const Rect& tile)
+{
+    auto* canvas = surface.GetCanvas();
+    // the surface is rounded up to whole pixels, map the tile onto it exactly
+    OH_Drawing_CanvasScale(canvas, surface.Width() / tile.Width(), surface.Height() / tile.Height());
+    if (attr_.viewBox.IsValid()) {
+        const Rect viewBox(vpToPx(attr_.viewBox.Left()), vpToPx(attr_.viewBox.Top()), vpToPx(attr_.viewBox.Width()),
+                           vpToPx(attr_.viewBox.Height()));
+        const auto transform = ResolveViewBox(viewBox, tile.GetSize(), align_, meetOrSlice_);
+        OH_Drawing_CanvasTranslate(canvas, transform.translateX, transform.translateY);
+        OH_Drawing_CanvasScale(canvas, transform.scaleX, transform.scaleY);
+    } else if (attr_.patternContentUnits == "objectBoundingBox") {
+        // children convert their coordinates with vpToPx, undo it so they
+        // are read as fractions of the target box
+        const double unit = vpToPx(1.0);
+        OH_Drawing_CanvasScale(canvas, bounds.Width() / unit, bounds.Height() / unit);
+    }
+    OnDrawTraversed(canvas);
+}
+
+OH_Drawing_ShaderEffect* SvgPattern::CreateShader(OffscreenSurface& surface, const Rect& tile) const
+{
+    // tile pixel -> tile origin in user space -> patternTransform
+    double a = 1.0, b = 0.0, c = 0.0, d = 1.0, e = 0.0, f = 0.0;
+    if (patternMatrix_.size() >= 6) {
+        a = patternMatrix_[0];
+        b = patternMatrix_[1];
+        c = patternMatrix_[2];
+        d = patternMatrix_[3];
+        e = vpToPx(patternMatrix_[4]);
+        f = vpToPx(patternMatrix_[5]);
+    }
+    const double sx = tile.Width() / surface.Width();
+    const double sy = tile.Height() / surface.Height();
+    auto* matrix = OH_Drawing_MatrixCreate();
+    OH_Drawing_MatrixSetMatrix(matrix, a * sx, c * sy, a * tile.Left() + c * tile.Top() + e, b * sx, d * sy,
+                               b * tile.Left() + d * tile.Top() + f, 0, 0, 1);
+    auto* shader = OH_Drawing_ShaderEffectCreateImageShader(surface.GetImage(), REPEAT, REPEAT, sampling_, matrix);
+    OH_Drawing_MatrixDestroy(matrix);
+    return shader;
+}
+
+} // namespace rnoh
@@ -0,0 +1,51 @@
+#pragma once
+#include <native_drawing/drawing_sampling_options.h>
+#include <native_drawing/drawing_shader_effect.h>
+#include <memory>
+#include <vector>
+#include "SvgQuote.h"
+#include "utils/OffscreenSurface.h"
+#include "utils/SvgAttributesParser.h"
+#include "utils/ViewBox.h"
+
+namespace rnoh {
+
+class SvgPattern : public SvgQuote {
+public:
+    SvgPattern();
+    ~SvgPattern() override;
+
+    SvgPatternAttribute attr_;
+    std::string align_;
+    MeetOrSlice meetOrSlice_ = MeetOrSlice::MEET;
+    // patternTransform as [a, b, c, d, e, f], empty for identity
+    std::vector<double> patternMatrix_;
+
+    // Repeating shader filling bounds with the pattern, owned by the pattern
+    // and valid until its next change. nullptr when the tile is empty.
+    OH_Drawing_ShaderEffect* GetShader(const Rect& bounds, float scale);
+
+protected:
+    bool HashContent(WideHash& seed) const override;
+
+private:
+    // one rendered tile and the shader repeating it
+    struct PatternTile {
+        Rect bounds;
+        float scale;
+        std::unique_ptr<OffscreenSurface> surface;
+        OH_Drawing_ShaderEffect* shader;
+    };
+
+    bool DependsOnBounds() const;
+    double GetTransformScale() const;
+    void RenderTile(OffscreenSurface& surface, const Rect& bounds, const Rect& tile);
+    OH_Drawing_ShaderEffect* CreateShader(OffscreenSurface& surface, const Rect& tile) const;
+    void ClearTiles();
+
+    std::vector<PatternTile> tiles_;
+    uint64_t tileGeneration_ = 0;
+    OH_Drawing_SamplingOptions* sampling_;
+};
+
+} // namespace rnoh
@@ -1,4 +1,4 @@
-
+#pragma once
 #include "SvgNode.h"
 #include <native_drawing/drawing_path.h>
 
@@ -28,8 +28,42 @@ class SvgQuote : public SvgNode {
   }
 
  protected:
-  virtual void OnDrawTraversedBefore(OH_Drawing_Canvas* canvas, Size viewPort) {}
-  virtual void OnDrawTraversedAfter(OH_Drawing_Canvas* canvas, Size viewPort) {}
+  virtual void OnDrawTraversedBefore(OH_Drawing_Canvas* canvas) {}
+  virtual void OnDrawTraversedAfter(OH_Drawing_Canvas* canvas) {}
+
+  // x/y/width/height are fractions of bounds for objectBoundingBox units,
+  // lengths against the root viewBox for userSpaceOnUse
+  Rect ResolveRegion(
+      const Dimension& x,
+      const Dimension& y,
+      const Dimension& width,
+      const Dimension& height,
+      bool boundingBoxUnits,
+      const Rect& bounds) const {
+    if (boundingBoxUnits) {
+      return Rect(
+          bounds.Left() + x.Value() * bounds.Width(),
+          bounds.Top() + y.Value() * bounds.Height(),
+          width.Value() * bounds.Width(),
+          height.Value() * bounds.Height());
+    }
+    const auto& viewBox = context_->GetRootViewBox();
+    const Size viewPort(vpToPx(viewBox.Width()), vpToPx(viewBox.Height()));
+    return Rect(
+        ConvertDimensionToPx(x, viewPort, SvgLengthType::HORIZONTAL),
+        ConvertDimensionToPx(y, viewPort, SvgLengthType::VERTICAL),
+        ConvertDimensionToPx(width, viewPort, SvgLengthType::HORIZONTAL),
+        ConvertDimensionToPx(height, viewPort, SvgLengthType::VERTICAL));
+  }
+
+  // cache keys tolerate sub-pixel jitter of the target bounds
+  static bool IsSameBounds(const Rect& a, const Rect& b) {
+    constexpr double epsilon = 0.5;
+    return NearEqual(a.Left(), b.Left(), epsilon) &&
+        NearEqual(a.Top(), b.Top(), epsilon) &&
+        NearEqual(a.Width(), b.Width(), epsilon) &&
+        NearEqual(a.Height(), b.Height(), epsilon);
+  }
 
   // mask/pattern/filter/clipPath
   void InitHrefFlag() {
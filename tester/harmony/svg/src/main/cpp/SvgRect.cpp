@@ -1,7 +1,35 @@
 #include "SvgRect.h"
+#include "properties/SvgDomType.h"
 
 namespace rnoh {
 
- } // namespace rnoh
+namespace {
+const std::pair<const char *, SvgRect::Float SvgRect::*> ANIMATED_FIELDS[] = {
+    {DOM_SVG_X, &SvgRect::x},
+    {DOM_SVG_Y, &SvgRect::y},
+    {DOM_SVG_WIDTH, &SvgRect::width},
+    {DOM_SVG_HEIGHT, &SvgRect::height},
+    {DOM_SVG_RX, &SvgRect::rx},
+    {DOM_SVG_RY, &SvgRect::ry},
+};
+} // namespace
 
+bool SvgRect::GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return GetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::GetAnimatedAttr(name, value);
+}
 
+bool SvgRect::SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) {
+    for (const auto &[attr, field] : ANIMATED_FIELDS) {
+        if (name == attr) {
+            return SetAnimatedField(this->*field, value);
+        }
+    }
+    return SvgGraphic::SetAnimatedAttr(name, value);
+}
+
+} // namespace rnoh
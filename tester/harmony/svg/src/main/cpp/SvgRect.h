@@ -20,6 +20,9 @@ public:
     Float ry;
     
     
+    bool GetAnimatedAttr(const std::string &name, SvgAnimatedValue &value) const override;
+    bool SetAnimatedAttr(const std::string &name, const SvgAnimatedValue &value) override;
+
     OH_Drawing_Path *AsPath() const override {
         LOG(INFO) << "[SvgRect] AsPath";
         //TODO implement ConvertDimensionToPx
@@ -28,6 +31,14 @@ public:
         OH_Drawing_PathAddRoundRect(path_, roundRect, PATH_DIRECTION_CW);
         return path_;
     };
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        for (Float value : {x, y, width, height, rx, ry}) {
+            HashCombine(seed, value);
+        }
+        return SvgGraphic::HashContent(seed);
+    }
 };
 
 } // namespace rnoh
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "SvgSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <glog/logging.h>
+#include "utils/ImageEncoder.h"
+#include "utils/OffscreenSurface.h"
+#include "utils/SvgPicture.h"
+
+namespace rnoh {
+
+namespace {
+// rows rendered per replay, 4 MB of pixels at 16K wide
+constexpr uint32_t BAND_ROWS = 64;
+// bounds a single snapshot dimension, past it surfaces can't be allocated
+constexpr float MAX_SNAPSHOT_SIZE = 16384.0f;
+// zlib's deflate state at the default level
+constexpr size_t DEFLATE_BYTES = 256 * 1024;
+constexpr size_t ENCODER_OUTPUT_BYTES = 64 * 1024;
+
+float GetScale(const SnapshotOptions& options)
+{
+    return options.scale > 0.0f ? options.scale : 1.0f;
+}
+
+// Layout the document is fitted into and the output size in pixels, false
+// when the output would be empty or too large.
+bool GetSnapshotSize(const SvgSvg& svg, const SnapshotOptions& options, Size& layout, uint32_t& width,
+                     uint32_t& height)
+{
+    layout = svg.GetLayoutSize();
+    if (options.width > 0.0f && options.height > 0.0f) {
+        layout = Size(options.width, options.height);
+    }
+    const float scale = GetScale(options);
+    const float outputWidth = std::ceil(layout.Width() * scale);
+    const float outputHeight = std::ceil(layout.Height() * scale);
+    if (!(outputWidth >= 1.0f && outputHeight >= 1.0f) || outputWidth > MAX_SNAPSHOT_SIZE ||
+        outputHeight > MAX_SNAPSHOT_SIZE) {
+        return false;
+    }
+    width = static_cast<uint32_t>(outputWidth);
+    height = static_cast<uint32_t>(outputHeight);
+    return true;
+}
+
+// a guess at 8:1 for PNG and 16:1 for JPEG, grown like any string past it
+size_t GuessBase64Size(const SnapshotOptions& options, uint32_t width, uint32_t height)
+{
+    return static_cast<size_t>(width) * height * (options.format == SnapshotFormat::JPEG ? 1 : 2) / 3 + 64;
+}
+} // namespace
+
+size_t EstimateSnapshotBytes(const SvgSvg& svg, const SnapshotOptions& options)
+{
+    Size layout;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    if (!GetSnapshotSize(svg, options, layout, width, height)) {
+        return 0;
+    }
+    const size_t band = static_cast<size_t>(width) * std::min(height, BAND_ROWS) * 4;
+    // PNG keeps two unfiltered and two filtered rows, JPEG one 16 row RGB strip
+    const size_t encoder = options.format == SnapshotFormat::JPEG
+        ? static_cast<size_t>(width + 15) * 16 * 3
+        : static_cast<size_t>(width) * 16 + DEFLATE_BYTES;
+    return band + encoder + ENCODER_OUTPUT_BYTES + GuessBase64Size(options, width, height);
+}
+
+std::string SnapshotToBase64(SvgSvg& svg, const SnapshotOptions& options)
+{
+    Size layout;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    if (!GetSnapshotSize(svg, options, layout, width, height)) {
+        LOG(WARNING) << "[SvgSnapshot] invalid size for " << options.width << "x" << options.height << " at "
+                     << options.scale;
+        return "";
+    }
+    const float scale = GetScale(options);
+
+    // recorded once, the tree is free again while the bands are rendered
+    auto picture = svg.RecordSnapshot(layout, scale);
+    if (!picture) {
+        return "";
+    }
+    OffscreenSurface band(width, std::min(height, BAND_ROWS));
+    if (!band.IsValid()) {
+        return "";
+    }
+
+    std::string base64;
+    base64.reserve(GuessBase64Size(options, width, height));
+    Base64Sink sink(base64);
+    auto encoder = options.format == SnapshotFormat::JPEG
+        ? CreateJpegEncoder(sink, width, height, std::clamp(options.quality, 0.01, 1.0))
+        : CreatePngEncoder(sink, width, height);
+    auto* canvas = band.GetCanvas();
+    for (uint32_t top = 0; top < height; top += band.Height()) {
+        const uint32_t rows = std::min(band.Height(), height - top);
+        OH_Drawing_CanvasClear(canvas, 0x00000000);
+        OH_Drawing_CanvasSave(canvas);
+        OH_Drawing_CanvasTranslate(canvas, 0.0f, -static_cast<float>(top));
+        OH_Drawing_CanvasScale(canvas, scale, scale);
+        picture->Draw(canvas);
+        OH_Drawing_CanvasRestore(canvas);
+        if (!encoder->WriteRows(band.GetPixels(), static_cast<size_t>(width) * 4, rows)) {
+            return "";
+        }
+    }
+    if (!encoder->Finish()) {
+        return "";
+    }
+    sink.Finish();
+    return base64;
+}
+
+} // namespace rnoh
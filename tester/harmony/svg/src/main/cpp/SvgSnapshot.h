@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "SvgSvg.h"
+
+namespace rnoh {
+
+enum class SnapshotFormat {
+    PNG,
+    JPEG,
+};
+
+struct SnapshotOptions {
+    // px the document is fitted into, the view's layout size when 0
+    float width = 0.0f;
+    float height = 0.0f;
+    // output pixels per px
+    float scale = 1.0f;
+    SnapshotFormat format = SnapshotFormat::PNG;
+    // JPEG only, in (0, 1]
+    double quality = 0.92;
+};
+
+// Renders the document away from the screen and returns the encoded image in
+// base64, empty on failure. Runs on any thread; the tree mutex is held only
+// while the document is recorded. Pixels pass through a fixed size band that
+// is encoded as it fills, so memory does not grow with the output size.
+std::string SnapshotToBase64(SvgSvg& svg, const SnapshotOptions& options);
+
+// Peak bytes SnapshotToBase64 allocates for options, 0 when it would fail.
+size_t EstimateSnapshotBytes(const SvgSvg& svg, const SnapshotOptions& options);
+
+} // namespace rnoh
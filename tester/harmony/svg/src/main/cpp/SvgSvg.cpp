@@ -1,23 +1,49 @@
 
 #include "SvgSvg.h"
+#include <cmath>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "properties/Size.h"
 #include "properties/SvgDomType.h"
+#include "utils/ImageCache.h"
 #include "utils/LinearMap.h"
 #include "utils/StringUtils.h"
 
+#include <native_drawing/drawing_matrix.h>
 #include <native_drawing/drawing_rect.h>
+#include "utils/OffscreenSurface.h"
+#include "utils/SvgPicture.h"
 #include "utils/Utils.h"
+#include "utils/WorkerPool.h"
 
 namespace rnoh {
 namespace {
 const char DOM_SVG_SRC_VIEW_BOX[] = "viewBox";
+// below this many nodes the hand-off to other cores costs more than it saves
+constexpr size_t PARALLEL_GEOMETRY_MIN_NODES = 256;
+// prepares given up in a row before one runs to the end regardless, so a
+// document updated every frame still gets frames
+constexpr uint32_t MAX_YIELDED_PREPARES = 2;
+constexpr double NS_PER_MS = 1e6;
+
+std::mutex g_documentsMutex;
+std::unordered_map<int32_t, std::weak_ptr<SvgSvg>> g_documents;
 }
 
 SvgSvg::SvgSvg() : SvgGroup() {}
 
+SvgSvg::~SvgSvg() {
+  if (viewportMatrix_) {
+    OH_Drawing_MatrixDestroy(viewportMatrix_);
+  }
+  if (sampling_) {
+    OH_Drawing_SamplingOptionsDestroy(sampling_);
+  }
+}
+
 OH_Drawing_Path* SvgSvg::AsPath() const {
   auto* path = OH_Drawing_PathCreate();
   for (const auto& child : children_) {
@@ -31,71 +57,285 @@ Size SvgSvg::GetSize() const {
   return {attr_.width.Value(), attr_.height.Value()};
 }
 
-void SvgSvg::FitCanvas(OH_Drawing_Canvas* canvas) {
-  float scaleViewBox = 1.0;
-  float tx = 0.0;
-  float ty = 0.0;
-  constexpr float half = 0.5f;
-
-  const Rect viewBox(attr_.x.Value(), attr_.y.Value(), attr_.width.Value(), attr_.height.Value()); // should be viewBox attribute
-  const auto svgSize = Size(attr_.width.Value(), attr_.height.Value()); // should be width and height defined in attribute
-  const auto layout = Size(
-      OH_Drawing_CanvasGetWidth(canvas), OH_Drawing_CanvasGetHeight(canvas));
-  /*
-   * 1. viewBox_, svgSize_, and layout are on 3 different scales.
-   * 2. Elements are painted in viewBox_ scale but displayed in layout scale.
-   * 3. To center align svg content, we first align viewBox_ to svgSize_, then
-   * we align svgSize_ to layout.
-   * 4. Canvas is initially in layout scale, so transformation (tx, ty) needs to
-   * be in that scale, too.
-   */
-  if (viewBox.IsValid()) {
-    if (svgSize.IsValid() && !svgSize.IsInfinite()) {
-      // center align viewBox_ to svg, need to map viewBox_ to the scale of
-      // svgSize_
-      scaleViewBox = std::min(
-          svgSize.Width() / viewBox.Width(),
-          svgSize.Height() / viewBox.Height());
-      tx = svgSize.Width() * half -
-          (viewBox.Width() * half + viewBox.Left()) * scaleViewBox;
-      ty = svgSize.Height() * half -
-          (viewBox.Height() * half + viewBox.Top()) * scaleViewBox;
-
-      // center align svg to layout container
-      tx += (layout.Width() - svgSize.Width()) * half;
-      ty += (layout.Height() - svgSize.Height()) * half;
-    } else if (!layout.IsEmpty()) {
-      // no svgSize_, center align viewBox to layout container
-      scaleViewBox = std::min(
-          layout.Width() / viewBox.Width(), layout.Height() / viewBox.Height());
-      tx = layout.Width() * half -
-          (viewBox.Width() * half + viewBox.Left()) * scaleViewBox;
-      ty = layout.Height() * half -
-          (viewBox.Height() * half + viewBox.Top()) * scaleViewBox;
-    } else {
-      // LOGW("FitImage containerSize and svgSize is null");
-    }
+bool SvgSvg::HashContent(WideHash& seed) const {
+  HashDimension(seed, attr_.x);
+  HashDimension(seed, attr_.y);
+  HashDimension(seed, attr_.width);
+  HashDimension(seed, attr_.height);
+  HashCombine(seed, align_);
+  HashCombine(seed, static_cast<int>(meetOrSlice_));
+  return true;
+}
+
+void SvgSvg::UpdateViewport(const Size& layout) {
+  const Rect viewBox(
+      attr_.x.Value(), attr_.y.Value(), attr_.width.Value(), attr_.height.Value());
+  const double density = vpToPx(1.0);
+  if (viewportMatrix_ && layout == viewportLayout_ &&
+      viewBox.Left() == viewportViewBox_.Left() &&
+      viewBox.Top() == viewportViewBox_.Top() &&
+      viewBox.Width() == viewportViewBox_.Width() &&
+      viewBox.Height() == viewportViewBox_.Height() &&
+      align_ == viewportAlign_ && meetOrSlice_ == viewportMeetOrSlice_ &&
+      density == viewportDensity_) {
+    return;
   }
+  viewportLayout_ = layout;
+  viewportViewBox_ = viewBox;
+  viewportAlign_ = align_;
+  viewportMeetOrSlice_ = meetOrSlice_;
+  viewportDensity_ = density;
+
+  // content is drawn in px of user units, so the viewBox is taken in px too
+  const Rect viewBoxPx(
+      vpToPx(viewBox.Left()),
+      vpToPx(viewBox.Top()),
+      vpToPx(viewBox.Width()),
+      vpToPx(viewBox.Height()));
+  const auto transform =
+      ResolveViewBox(viewBoxPx, layout, align_, meetOrSlice_);
+  if (!viewportMatrix_) {
+    viewportMatrix_ = OH_Drawing_MatrixCreate();
+  }
+  OH_Drawing_MatrixSetMatrix(
+      viewportMatrix_,
+      transform.scaleX,
+      0,
+      transform.translateX,
+      0,
+      transform.scaleY,
+      transform.translateY,
+      0,
+      0,
+      1.0);
+}
+
+Size SvgSvg::GetLayoutSize(OH_Drawing_Canvas* canvas) const {
+  const auto layout = GetLayoutSize();
+  return layout.IsValid()
+      ? layout
+      : Size(OH_Drawing_CanvasGetWidth(canvas), OH_Drawing_CanvasGetHeight(canvas));
+}
+
+void SvgSvg::FitCanvas(OH_Drawing_Canvas* canvas, const Size& layout) {
+  UpdateViewport(layout);
+
   auto* rect =
       OH_Drawing_RectCreate(0.0f, 0.0f, layout.Width(), layout.Height());
   OH_Drawing_CanvasClipRect(
       canvas, rect, OH_Drawing_CanvasClipOp::INTERSECT, true);
   OH_Drawing_RectDestroy(rect);
-  OH_Drawing_CanvasTranslate(canvas, tx, ty);
+  OH_Drawing_CanvasConcatMatrix(canvas, viewportMatrix_);
+}
 
-  if (NearZero(scaleViewBox)) {
-    return;
+void SvgSvg::UpdateViewBox() {
+  if (context_ &&
+      context_->SetViewBox(Rect(attr_.x.Value(), attr_.y.Value(), attr_.width.Value(), attr_.height.Value()))) {
+    RefreshTransformOrigins();
   }
-  OH_Drawing_CanvasScale(canvas, scaleViewBox, scaleViewBox);
 }
 
-void SvgSvg::Draw(OH_Drawing_Canvas* canvas) {
-  context_->SetViewBox(Rect(attr_.x.Value(), attr_.y.Value(), attr_.width.Value(), attr_.height.Value()));
-
+void SvgSvg::DrawContent(OH_Drawing_Canvas* canvas, const Size& layout, float baseScale) {
   // apply scale
   OH_Drawing_CanvasSave(canvas);
-  FitCanvas(canvas);
+  FitCanvas(canvas, layout);
+  // the only total matrix read per frame, nodes derive theirs from GetCtm()
+  context_->SetDeviceScale(baseScale * GetCanvasScale(canvas));
   SvgNode::Draw(canvas);
   OH_Drawing_CanvasRestore(canvas);
+}
+
+void SvgSvg::DrawCached(OH_Drawing_Canvas* canvas, const Size& layout) {
+  RasterCacheKey key;
+  key.scale = ScaleBucket(GetCanvasScale(canvas));
+  key.width = static_cast<uint32_t>(std::ceil(layout.Width() * key.scale));
+  key.height = static_cast<uint32_t>(std::ceil(layout.Height() * key.scale));
+  key.density = vpToPx(1.0);
+  key.tintColor = tintColor_;
+  key.contentHash = GetContentHash();
+  if (key.width == 0 || key.height == 0) {
+    return;
+  }
+  const uint64_t epoch = ImageCache::GetInstance().GetEpoch();
+  if (!raster_ || !(key == rasterKey_) || (!rasterComplete_ && rasterEpoch_ != epoch)) {
+    raster_ = RasterCache::GetInstance().Get(key);
+    rasterComplete_ = true;
+    if (!raster_) {
+      auto surface = std::make_shared<OffscreenSurface>(key.width, key.height);
+      if (!surface->IsValid()) {
+        DrawContent(canvas, layout);
+        return;
+      }
+      const uint64_t incomplete = context_->GetIncompleteCount();
+      OH_Drawing_CanvasScale(surface->GetCanvas(), key.scale, key.scale);
+      DrawContent(surface->GetCanvas(), layout);
+      rasterComplete_ = context_->GetIncompleteCount() == incomplete;
+      rasterEpoch_ = epoch;
+      if (rasterComplete_) {
+        RasterCache::GetInstance().Put(key, surface);
+      }
+      raster_ = std::move(surface);
+    }
+    rasterKey_ = key;
+  }
+  needsRedraw_ = !rasterComplete_;
+  if (!sampling_) {
+    sampling_ = OH_Drawing_SamplingOptionsCreate(FILTER_MODE_LINEAR, MIPMAP_MODE_NONE);
+  }
+  auto* rect = OH_Drawing_RectCreate(0.0f, 0.0f, layout.Width(), layout.Height());
+  OH_Drawing_CanvasDrawImageRect(canvas, raster_->GetImage(), rect, sampling_);
+  OH_Drawing_RectDestroy(rect);
+}
+
+void SvgSvg::SchedulePrepare(const Size& layout, float scale) {
+  if (preparing_.exchange(true)) {
+    return;
+  }
+  auto self = std::static_pointer_cast<SvgSvg>(shared_from_this());
+  WorkerPool::GetInstance().Post([self, layout, scale] {
+    auto frame = std::make_shared<PreparedFrame>();
+    frame->layout = layout;
+    frame->scale = scale;
+    {
+      std::lock_guard<std::mutex> lock(self->context_->GetTreeMutex());
+      // read first, a decode landing while recording triggers another pass
+      frame->imageEpoch = ImageCache::GetInstance().GetEpoch();
+      const uint64_t incomplete = self->context_->GetIncompleteCount();
+      self->context_->SetPreemptible(self->yieldedPrepares_ < MAX_YIELDED_PREPARES);
+      frame->picture = self->PrepareFrame(layout, scale);
+      self->context_->SetPreemptible(false);
+      // the tree the picture shows, still under the mutex
+      frame->generation = self->generation_;
+      frame->complete = self->context_->GetIncompleteCount() == incomplete;
+      self->yieldedPrepares_ = frame->picture ? 0 : self->yieldedPrepares_ + 1;
+    }
+    if (!frame->picture) {
+      // given up for the UI thread, the next draw schedules it again
+      self->preparing_ = false;
+      return;
+    }
+    std::atomic_store(&self->prepared_, std::shared_ptr<const PreparedFrame>(std::move(frame)));
+    self->preparing_ = false;
+  });
+}
+
+std::shared_ptr<SvgPicture> SvgSvg::PrepareFrame(const Size& layout, float scale) {
+  geometryNodes_.clear();
+  CollectNodes(geometryNodes_);
+  const uint64_t start = GetNanoseconds();
+  // nodes only write their own state, the draw order is not affected
+  auto& pool = WorkerPool::GetInstance();
+  const bool parallel = geometryNodes_.size() >= PARALLEL_GEOMETRY_MIN_NODES;
+  // geometry already built stays valid when the frame is given up
+  if (parallel) {
+    pool.ParallelFor(geometryNodes_.size(), [this](size_t i) {
+      if (!context_->ShouldYield()) {
+        geometryNodes_[i]->PrepareGeometry();
+      }
+    });
+  } else {
+    for (auto* node : geometryNodes_) {
+      if (context_->ShouldYield()) {
+        break;
+      }
+      node->PrepareGeometry();
+    }
+  }
+  if (context_->ShouldYield()) {
+    return nullptr;
+  }
+  const uint64_t geometryEnd = GetNanoseconds();
+  auto picture = SvgPicture::Record(
+      static_cast<int32_t>(std::ceil(layout.Width())),
+      static_cast<int32_t>(std::ceil(layout.Height())),
+      [&](OH_Drawing_Canvas* canvas) { DrawContent(canvas, layout, scale); });
+  // a waiting locker keeps waiting until the mutex is released, so a cut
+  // short recording is always seen here
+  if (context_->ShouldYield()) {
+    return nullptr;
+  }
+  const uint64_t recordEnd = GetNanoseconds();
+
+  timings_.nodes = geometryNodes_.size();
+  timings_.threads = parallel ? pool.GetThreadCount() + 1 : 1;
+  timings_.geometryMs = (geometryEnd - start) / NS_PER_MS;
+  timings_.recordMs = (recordEnd - geometryEnd) / NS_PER_MS;
+  return picture;
+}
+
+void SvgSvg::DrawPrepared(OH_Drawing_Canvas* canvas, const Size& layout) {
+  const float scale = ScaleBucket(GetCanvasScale(canvas));
+  auto frame = std::atomic_load(&prepared_);
+  // generation_ is only written by this thread, so it is read without the
+  // mutex the worker holds
+
+  if (!frame || frame->generation != generation_ || !(frame->layout == layout) || frame->scale != scale ||
+      (!frame->complete && frame->imageEpoch != ImageCache::GetInstance().GetEpoch())) {
+    SchedulePrepare(layout, scale);
+    needsRedraw_ = true;
+  } else if (!frame->complete) {
+    // nothing to record yet, keep polling until the missing content lands
+    needsRedraw_ = true;
+  }
+  // a stale frame beats a blank one while the current one is prepared
+  if (frame && frame->picture) {
+    frame->picture->Draw(canvas);
+  }
+}
+
+std::shared_ptr<SvgPicture> SvgSvg::RecordSnapshot(const Size& layout, float scale) {
+  if (!context_) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(context_->GetTreeMutex());
+  return PrepareFrame(layout, scale);
+}
+
+void SvgSvg::RegisterDocument(int32_t tag, const std::shared_ptr<SvgSvg>& svg) {
+  std::lock_guard<std::mutex> lock(g_documentsMutex);
+  for (auto it = g_documents.begin(); it != g_documents.end();) {
+    it = it->second.expired() ? g_documents.erase(it) : std::next(it);
+  }
+  g_documents[tag] = svg;
+}
+
+std::shared_ptr<SvgSvg> SvgSvg::FindDocument(int32_t tag) {
+  std::lock_guard<std::mutex> lock(g_documentsMutex);
+  auto it = g_documents.find(tag);
+  return it == g_documents.end() ? nullptr : it->second.lock();
+}
+
+void SvgSvg::OnDrawTraversed(OH_Drawing_Canvas* canvas) {
+  // blurred edges are handed down to the children by the tree walk
+  if (GetSmoothEdge() > 0.0f) {
+    SvgNode::OnDrawTraversed(canvas);
+    return;
+  }
+  drawList_.Draw(*this, canvas);
+}
+
+bool SvgSvg::TickAnimations(uint64_t nowNs) {
+  if (!context_ || !context_->HasAnimations()) {
+    return false;
+  }
+  // A prepare in flight holds the mutex. Preempting it from every frame
+  // would abort every prepare of an animated document, so the tick waits
+  // for the next frame. Ticks evaluate at nowNs, so skipping one loses no time.
+  std::unique_lock<std::mutex> lock(context_->GetTreeMutex(), std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return true;
+  }
+  return context_->TickAnimations(nowNs);
+}
+
+void SvgSvg::Draw(OH_Drawing_Canvas* canvas) {
+  const auto layout = GetLayoutSize(canvas);
+  needsRedraw_ = false;
+  if (rasterCache_) {
+    auto lock = context_->LockTreePreempting();
+    DrawCached(canvas, layout);
+    return;
+  }
+  DrawPrepared(canvas, layout);
 };
 } // namespace rnoh
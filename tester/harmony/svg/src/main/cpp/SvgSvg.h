@@ -3,24 +3,158 @@
 #include <native_drawing/drawing_canvas.h>
 #include <native_drawing/drawing_path.h>
 #include "SvgGroup.h"
+#include <native_drawing/drawing_sampling_options.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "utils/RasterCache.h"
 #include "utils/SvgAttributesParser.h"
+#include "utils/ViewBox.h"
 
 namespace rnoh {
 class SvgSvg : public SvgGroup {
  public:
   SvgSvg();
-  ~SvgSvg() override = default;
+  ~SvgSvg() override;
 
   OH_Drawing_Path* AsPath() const override;
 
   Size GetSize() const;
   void Draw(OH_Drawing_Canvas* canvas) override;
 
-  SvgAttributes attr_;
+  // size of the view in px, falls back to the canvas size while unknown.
+  // Set by the UI thread, read by snapshot workers.
+  void SetLayoutSize(const Size& size) {
+    std::lock_guard<std::mutex> lock(layoutMutex_);
+    layoutSize_ = size;
+  }
+  Size GetLayoutSize() const {
+    std::lock_guard<std::mutex> lock(layoutMutex_);
+    return layoutSize_;
+  }
+
+  // Records the document fitted into layout px at scale device pixels per
+  // px, for rendering away from the view. Takes the tree mutex.
+  std::shared_ptr<SvgPicture> RecordSnapshot(const Size& layout, float scale);
+
+  // Documents by the React tag of their view, for native modules that are
+  // handed a tag. Held weakly.
+  static void RegisterDocument(int32_t tag, const std::shared_ptr<SvgSvg>& svg);
+  static std::shared_ptr<SvgSvg> FindDocument(int32_t tag);
+
+  // Static mode: the document is rasterized once at device resolution and
+  // redrawn from a bitmap shared through RasterCache until it changes.
+  void SetRasterCache(bool enabled) {
+    rasterCache_ = enabled;
+    if (!enabled) {
+      raster_.reset();
+    }
+  }
+  void SetTintColor(uint32_t color) {
+    tintColor_ = color;
+  }
+
+  // Advances the document's animations to nowNs before a frame is drawn,
+  // true while they need further frames. Skipped while a worker prepares a
+  // frame; the next tick catches up.
+  bool TickAnimations(uint64_t nowNs);
+
+  // phases of the last frame preparation
+  struct PrepareTimings {
+    size_t nodes = 0;
+    size_t threads = 0;
+    double geometryMs = 0.0;
+    double recordMs = 0.0;
+  };
+  // read under the tree mutex
+  const PrepareTimings& GetPrepareTimings() const {
+    return timings_;
+  }
+
+  // True when the last Draw showed a frame older than the document; the host
+  // draws again until the worker has published the current one.
+  bool NeedsRedraw() const {
+    return needsRedraw_;
+  }
+
+  // Publishes the viewBox in attr_ to the context, re-resolving percent
+  // transform-origins when it was resized. Called by the UI thread under the
+  // tree mutex when the props change, so preparing a frame only reads the
+  // tree.
+  void UpdateViewBox();
+
+  SvgAttributes attr_; // viewBox in user units
+  std::string align_;
+  MeetOrSlice meetOrSlice_ = MeetOrSlice::MEET;
+
+ protected:
+  // children are drawn from drawList_
+  void OnDrawTraversed(OH_Drawing_Canvas* canvas) override;
+  // a nested document draws itself
+  bool PrepareFlatDraw(SvgDrawRecord& record) override {
+    return false;
+  }
 
  private:
-  void FitCanvas(OH_Drawing_Canvas* canvas);
+  bool HashContent(WideHash& seed) const override;
+  Size GetLayoutSize(OH_Drawing_Canvas* canvas) const;
+  void FitCanvas(OH_Drawing_Canvas* canvas, const Size& layout);
+  // Draws the tree, the caller holds the tree mutex. baseScale is the device
+  // scale of canvas not visible in its matrix, e.g. when recording.
+  void DrawContent(OH_Drawing_Canvas* canvas, const Size& layout, float baseScale = 1.0f);
+  void DrawCached(OH_Drawing_Canvas* canvas, const Size& layout);
+  void DrawPrepared(OH_Drawing_Canvas* canvas, const Size& layout);
+  // Records the tree into a new PreparedFrame on the worker pool, at most
+  // one recording per document is in flight.
+  void SchedulePrepare(const Size& layout, float scale);
+  // Builds the geometry of every node, spread over the pool's cores for
+  // large documents, then records the tree. The caller holds the tree mutex.
+  // nullptr when the context is preemptible and the UI thread asked for the
+  // mutex meanwhile.
+  std::shared_ptr<SvgPicture> PrepareFrame(const Size& layout, float scale);
+  // Rebuilds viewportMatrix_ when any input of the viewport fit changed.
+  void UpdateViewport(const Size& layout);
+
+  mutable std::mutex layoutMutex_;
+  Size layoutSize_;
+  OH_Drawing_Matrix* viewportMatrix_ = nullptr;
+  // inputs viewportMatrix_ was built from
+  Size viewportLayout_;
+  Rect viewportViewBox_;
+  std::string viewportAlign_;
+  MeetOrSlice viewportMeetOrSlice_ = MeetOrSlice::MEET;
+  double viewportDensity_ = 0.0;
+
+  bool rasterCache_ = false;
+  uint32_t tintColor_ = 0;
+  RasterCacheKey rasterKey_;
+  std::shared_ptr<OffscreenSurface> raster_;
+  // raster_ left out content still loading, kept out of RasterCache and
+  // rendered again once ImageCache moves past rasterEpoch_
+  bool rasterComplete_ = true;
+  uint64_t rasterEpoch_ = 0;
+  OH_Drawing_SamplingOptions* sampling_ = nullptr;
 
+  // display list of the whole document, immutable once published
+  struct PreparedFrame {
+    std::shared_ptr<SvgPicture> picture;
+    uint64_t generation = 0;
+    Size layout;
+    float scale = 1.0f;
+    // false when content still loading was left out
+    bool complete = true;
+    // ImageCache epoch the recording started at
+    uint64_t imageEpoch = 0;
+  };
+  // swapped with std::atomic_load/atomic_store
+  std::shared_ptr<const PreparedFrame> prepared_;
+  std::atomic<bool> preparing_{false};
+  // prepares given up for the UI thread since the last published one
+  uint32_t yieldedPrepares_ = 0;
+  std::vector<SvgNode*> geometryNodes_;
+  PrepareTimings timings_;
+  SvgDrawList drawList_;
+  bool needsRedraw_ = false;
 };
 
 } // namespace rnoh
@@ -0,0 +1,48 @@
+#pragma once
+#include "SvgQuote.h"
+#include <native_drawing/drawing_rect.h>
+#include "utils/ViewBox.h"
+
+namespace rnoh {
+
+// Template only drawn through <use>, which supplies the viewport size.
+class SvgSymbol : public SvgQuote {
+public:
+    SvgSymbol() : SvgQuote() {}
+    ~SvgSymbol() override = default;
+
+    Rect viewBox_;
+    std::string align_;
+    MeetOrSlice meetOrSlice_ = MeetOrSlice::MEET;
+
+    // Draws the shared recording of the children into a width x height
+    // viewport in pixels, the origin of the canvas being the viewport's.
+    void DrawInstance(OH_Drawing_Canvas* canvas, double width, double height)
+    {
+        if (viewBox_.IsValid()) {
+            if (width <= 0.0 || height <= 0.0) {
+                return;
+            }
+            const Rect viewBox(vpToPx(viewBox_.Left()), vpToPx(viewBox_.Top()), vpToPx(viewBox_.Width()),
+                               vpToPx(viewBox_.Height()));
+            const auto transform = ResolveViewBox(viewBox, Size(width, height), align_, meetOrSlice_);
+            auto* rect = OH_Drawing_RectCreate(0, 0, width, height);
+            OH_Drawing_CanvasClipRect(canvas, rect, OH_Drawing_CanvasClipOp::INTERSECT, true);
+            OH_Drawing_RectDestroy(rect);
+            OH_Drawing_CanvasTranslate(canvas, transform.translateX, transform.translateY);
+            OH_Drawing_CanvasScale(canvas, transform.scaleX, transform.scaleY);
+        }
+        DrawRecorded(canvas);
+    }
+
+protected:
+    bool HashContent(WideHash& seed) const override
+    {
+        HashRect(seed, viewBox_);
+        HashCombine(seed, align_);
+        HashCombine(seed, static_cast<int>(meetOrSlice_));
+        return true;
+    }
+};
+
+} // namespace rnoh
@@ -0,0 +1,23 @@
+#pragma once
+#include "SvgText.h"
+
+namespace rnoh {
+
+// <tspan>, laid out and drawn by the enclosing <text>.
+class SvgTSpan : public SvgText {
+public:
+    SvgTSpan() = default;
+    ~SvgTSpan() override = default;
+
+    void SetContent(const std::string &content) {
+        auto decoded = DecodeUtf8(content);
+        if (decoded == content_) {
+            return;
+        }
+        content_ = std::move(decoded);
+        shapedValid_ = false;
+        InvalidateLayout();
+    }
+};
+
+} // namespace rnoh
@@ -0,0 +1,792 @@
+#include "SvgText.h"
+#include "SvgTextPath.h"
+#include <cstdlib>
+#include <native_drawing/drawing_matrix.h>
+#include <native_drawing/drawing_rect.h>
+#include "utils/FontCache.h"
+
+namespace rnoh {
+namespace {
+// initial font-size, in user units
+constexpr double DEFAULT_FONT_SIZE = 12.0;
+constexpr int NORMAL_WEIGHT = 400;
+constexpr int BOLD_WEIGHT = 700;
+// baseline-shift sub and super as fractions of the font size
+constexpr double SUB_SHIFT = 0.2;
+constexpr double SUPER_SHIFT = 0.4;
+constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+// method="stretch" bends each glyph as strips this wide, in user units
+constexpr float STRETCH_STRIP_WIDTH = 2.0f;
+constexpr int MAX_STRETCH_STRIPS = 32;
+// spacing="auto" scales gaps by at most this much either way on tight curves
+constexpr float MAX_SPACING_SCALE = 4.0f;
+
+// A length in px: user units unless suffixed, percentages of percentBase,
+// em and ex of fontSize. False for an empty or malformed value.
+bool ParseLength(const std::string &value, double fontSize, double percentBase, double &result)
+{
+    const char *begin = value.c_str();
+    char *end = nullptr;
+    const double number = std::strtod(begin, &end);
+    if (end == begin) {
+        return false;
+    }
+    std::string unit(end);
+    unit.erase(0, unit.find_first_not_of(' '));
+    unit.erase(unit.find_last_not_of(' ') + 1);
+    if (unit == "%") {
+        result = number * percentBase / 100.0;
+    } else if (unit == "em") {
+        result = number * fontSize;
+    } else if (unit == "ex") {
+        result = number * fontSize * 0.5;
+    } else if (unit == "pt") {
+        result = vpToPx(number * 4.0 / 3.0);
+    } else {
+        result = vpToPx(number);
+    }
+    return true;
+}
+
+int ResolveWeight(const std::string &value, int parent)
+{
+    if (value.empty()) {
+        return parent;
+    }
+    if (value == "normal") {
+        return NORMAL_WEIGHT;
+    }
+    if (value == "bold") {
+        return BOLD_WEIGHT;
+    }
+    if (value == "bolder") {
+        return parent < NORMAL_WEIGHT ? NORMAL_WEIGHT : (parent < 600 ? BOLD_WEIGHT : 900);
+    }
+    if (value == "lighter") {
+        return parent < 600 ? 100 : (parent < 800 ? NORMAL_WEIGHT : BOLD_WEIGHT);
+    }
+    const int weight = std::atoi(value.c_str());
+    return weight > 0 ? std::clamp(weight, 1, 1000) : parent;
+}
+
+// Offset of the baseline from the alignment point, down positive.
+float AlignmentOffset(const std::string &alignment, const OH_Drawing_Font_Metrics &metrics)
+{
+    if (alignment == "middle") {
+        return metrics.xHeight * 0.5f;
+    }
+    if (alignment == "central") {
+        return -(metrics.ascent + metrics.descent) * 0.5f;
+    }
+    if (alignment == "hanging") {
+        return -metrics.ascent * 0.8f;
+    }
+    if (alignment == "mathematical") {
+        return -metrics.ascent * 0.5f;
+    }
+    if (alignment == "text-before-edge" || alignment == "before-edge" || alignment == "top" ||
+        alignment == "text-top") {
+        return -metrics.ascent;
+    }
+    if (alignment == "text-after-edge" || alignment == "after-edge" || alignment == "bottom" ||
+        alignment == "text-bottom" || alignment == "ideographic") {
+        return -metrics.descent;
+    }
+    return 0.0f;
+}
+
+// baseline-shift, down positive
+float BaselineShift(const std::string &shift, double fontSize)
+{
+    if (shift == "sub") {
+        return static_cast<float>(fontSize * SUB_SHIFT);
+    }
+    if (shift == "super") {
+        return static_cast<float>(-fontSize * SUPER_SHIFT);
+    }
+    double length = 0.0;
+    if (shift != "baseline" && ParseLength(shift, fontSize, fontSize, length)) {
+        return static_cast<float>(-length);
+    }
+    return 0.0f;
+}
+
+// font-stretch keywords on the 1-9 width scale
+int ResolveWidth(const std::string &value, int parent)
+{
+    static const std::pair<const char *, int> keywords[] = {
+        {"ultra-condensed", 1}, {"extra-condensed", 2}, {"condensed", 3}, {"semi-condensed", 4}, {"normal", 5},
+        {"semi-expanded", 6},   {"expanded", 7},        {"extra-expanded", 8}, {"ultra-expanded", 9}};
+    for (const auto &[name, width] : keywords) {
+        if (value == name) {
+            return width;
+        }
+    }
+    if (value == "wider") {
+        return std::min(parent + 1, 9);
+    }
+    if (value == "narrower") {
+        return std::max(parent - 1, 1);
+    }
+    return parent;
+}
+
+enum class TextAnchor { START, MIDDLE, END };
+
+TextAnchor ParseAnchor(const std::string &value)
+{
+    if (value == "middle") {
+        return TextAnchor::MIDDLE;
+    }
+    if (value == "end") {
+        return TextAnchor::END;
+    }
+    return TextAnchor::START;
+}
+} // namespace
+
+// inherited values of the element being laid out
+struct SvgText::ResolvedStyle {
+    FontSpec font;
+    std::string textAnchor;
+    double letterSpacing = 0.0;
+    double wordSpacing = 0.0;
+    float baseline = 0.0f;
+};
+
+struct SvgText::LayoutState {
+    Size viewPort;
+    float x = 0.0f;
+    float y = 0.0f;
+    // elements enclosing the next character, with the number of characters
+    // laid out in each so far
+    std::vector<std::pair<const SvgText *, size_t>> contexts;
+    // start of the current text chunk
+    bool inChunk = false;
+    size_t chunkRun = 0;
+    size_t chunkGlyph = 0;
+    float chunkStartX = 0.0f;
+    TextAnchor chunkAnchor = TextAnchor::START;
+};
+
+void SvgText::SetFont(const SvgFontAttributes &font) {
+    if (font == font_) {
+        return;
+    }
+    font_ = font;
+    InvalidateLayout();
+}
+
+void SvgText::SetPositions(const std::vector<std::string> &x, const std::vector<std::string> &y,
+                           const std::vector<std::string> &dx, const std::vector<std::string> &dy,
+                           const std::vector<std::string> &rotate) {
+    if (x == x_ && y == y_ && dx == dx_ && dy == dy_ && rotate == rotate_) {
+        return;
+    }
+    x_ = x;
+    y_ = y;
+    dx_ = dx;
+    dy_ = dy;
+    rotate_ = rotate;
+    InvalidateLayout();
+}
+
+void SvgText::SetTextLength(const std::string &textLength, const std::string &lengthAdjust) {
+    if (textLength == textLength_ && lengthAdjust == lengthAdjust_) {
+        return;
+    }
+    textLength_ = textLength;
+    lengthAdjust_ = lengthAdjust;
+    InvalidateLayout();
+}
+
+void SvgText::SetBaseline(const std::string &baselineShift, const std::string &alignmentBaseline) {
+    if (baselineShift == baselineShift_ && alignmentBaseline == alignmentBaseline_) {
+        return;
+    }
+    baselineShift_ = baselineShift;
+    alignmentBaseline_ = alignmentBaseline;
+    InvalidateLayout();
+}
+
+void SvgText::OnAppendChild(const std::shared_ptr<SvgNode> &child) {
+    if (auto *text = dynamic_cast<SvgText *>(child.get())) {
+        // drawn from the runs of the outermost element
+        text->drawTraversed_ = false;
+    }
+    InvalidateLayout();
+}
+
+void SvgText::OnRemoveChild(const std::shared_ptr<SvgNode> &child) {
+    if (auto *text = dynamic_cast<SvgText *>(child.get())) {
+        // a root of its own until inserted again
+        text->drawTraversed_ = true;
+        text->InvalidateLayout();
+    }
+    InvalidateLayout();
+}
+
+void SvgText::InvalidateLayout() {
+    for (auto *text = this; text; text = dynamic_cast<SvgText *>(text->parent_)) {
+        ++text->layoutVersion_;
+    }
+}
+
+bool SvgText::IsTextRoot() const { return !dynamic_cast<SvgText *>(parent_); }
+
+void SvgText::PrepareGeometry() {
+    // text on a path reads the path's geometry, which may be prepared
+    // concurrently, so it is laid out when drawn instead
+    if (IsTextRoot() && !ContainsTextPath()) {
+        UpdateLayout();
+    }
+}
+
+void SvgText::UpdateLayout() {
+    Size viewPort;
+    if (context_) {
+        const auto &viewBox = context_->GetRootViewBox();
+        viewPort = Size(vpToPx(viewBox.Width()), vpToPx(viewBox.Height()));
+    }
+    if (laidOutVersion_ == layoutVersion_ && laidOutViewPort_ == viewPort && !PathsChanged()) {
+        return;
+    }
+    runs_.clear();
+    pathDependencies_.clear();
+    LayoutState state;
+    state.viewPort = viewPort;
+    ResolvedStyle initial;
+    initial.font.size = static_cast<float>(vpToPx(DEFAULT_FONT_SIZE));
+    LayoutElement(this, initial, state);
+    EndChunk(state);
+
+    for (auto &run : runs_) {
+        BuildBlobs(run);
+    }
+    layoutBounds_ = GetRunBounds(nullptr);
+    laidOutVersion_ = layoutVersion_;
+    laidOutViewPort_ = viewPort;
+}
+
+void SvgText::LayoutElement(SvgText *element, const ResolvedStyle &parent, LayoutState &state) {
+    const auto &attrs = element->font_;
+    ResolvedStyle style = parent;
+    style.font.family = attrs.family.empty() ? parent.font.family : attrs.family;
+    double size = 0.0;
+    if (ParseLength(attrs.size, parent.font.size, parent.font.size, size) && size > 0.0) {
+        style.font.size = static_cast<float>(size);
+    }
+    style.font.weight = ResolveWeight(attrs.weight, parent.font.weight);
+    style.font.width = ResolveWidth(attrs.stretch, parent.font.width);
+    if (!attrs.style.empty()) {
+        style.font.italic = attrs.style == "italic" || attrs.style == "oblique";
+    }
+    if (!attrs.textAnchor.empty()) {
+        style.textAnchor = attrs.textAnchor;
+    }
+    ParseLength(attrs.letterSpacing, style.font.size, style.font.size, style.letterSpacing);
+    ParseLength(attrs.wordSpacing, style.font.size, style.font.size, style.wordSpacing);
+
+    if (!element->shapedFont_ || element->shapedFont_->GetSpec() != style.font) {
+        element->shapedFont_ = std::make_shared<TextFont>(style.font);
+        element->shapedValid_ = false;
+    }
+    if (!element->shapedValid_) {
+        element->shapedFont_->Shape(element->content_, element->shapedGlyphs_, element->shapedAdvances_);
+        element->shapedValid_ = true;
+    }
+    style.baseline += BaselineShift(element->baselineShift_, style.font.size) +
+                      AlignmentOffset(element->alignmentBaseline_, element->shapedFont_->GetMetrics());
+
+    auto *textPath = dynamic_cast<SvgTextPath *>(element);
+    const PathPoint outside{state.x, state.y};
+    const ArcLengthTable *pathTable = textPath ? BeginTextPath(*textPath, style.font.size, state) : nullptr;
+    const size_t firstRun = runs_.size();
+    const float startX = state.x;
+    state.contexts.emplace_back(element, 0);
+
+    const auto &glyphs = element->shapedGlyphs_;
+    if (!glyphs.empty()) {
+        // in runs_ already, so anchoring a chunk that ends inside the run
+        // reaches its earlier glyphs
+        runs_.push_back(GlyphRun{element, element->shapedFont_});
+        auto &run = runs_.back();
+        run.glyphs = glyphs;
+        run.advances = element->shapedAdvances_;
+        run.positions.reserve(glyphs.size() * 2);
+        // the nearest enclosing element with a value for the character wins
+        auto lookup = [&state](std::vector<std::string> SvgText::*list, double percentBase, double fontSize,
+                               double &value) {
+            for (auto it = state.contexts.rbegin(); it != state.contexts.rend(); ++it) {
+                const auto &values = it->first->*list;
+                if (it->second < values.size()) {
+                    return ParseLength(values[it->second], fontSize, percentBase, value);
+                }
+            }
+            return false;
+        };
+        bool rotated = false;
+        for (size_t i = 0; i < glyphs.size(); ++i) {
+            const double fontSize = style.font.size;
+            double value = 0.0;
+            bool absolute = false;
+            if (lookup(&SvgText::x_, state.viewPort.Width(), fontSize, value)) {
+                state.x = static_cast<float>(value);
+                absolute = true;
+            }
+            if (lookup(&SvgText::y_, state.viewPort.Height(), fontSize, value)) {
+                state.y = static_cast<float>(value);
+                absolute = true;
+            }
+            if (absolute || !state.inChunk) {
+                EndChunk(state);
+                state.inChunk = true;
+                state.chunkRun = runs_.size() - 1;
+                state.chunkGlyph = i;
+                state.chunkStartX = state.x;
+                state.chunkAnchor = ParseAnchor(style.textAnchor);
+            }
+            if (lookup(&SvgText::dx_, state.viewPort.Width(), fontSize, value)) {
+                state.x += static_cast<float>(value);
+            }
+            if (lookup(&SvgText::dy_, state.viewPort.Height(), fontSize, value)) {
+                state.y += static_cast<float>(value);
+            }
+            // the last rotate value carries over to the characters after it
+            float rotation = 0.0f;
+            for (auto it = state.contexts.rbegin(); it != state.contexts.rend(); ++it) {
+                const auto &values = it->first->rotate_;
+                if (!values.empty()) {
+                    rotation = std::strtof(values[std::min(it->second, values.size() - 1)].c_str(), nullptr);
+                    break;
+                }
+            }
+            if (rotation != 0.0f && !rotated) {
+                run.rotations.assign(glyphs.size(), 0.0f);
+                rotated = true;
+            }
+            if (rotated) {
+                run.rotations[i] = rotation;
+            }
+            run.positions.push_back(state.x);
+            run.positions.push_back(state.y + style.baseline);
+            state.x += run.advances[i] + static_cast<float>(style.letterSpacing);
+            if (element->content_[i] == U' ') {
+                state.x += static_cast<float>(style.wordSpacing);
+            }
+            for (auto &context : state.contexts) {
+                ++context.second;
+            }
+        }
+    }
+
+    for (const auto &child : element->children_) {
+        if (auto *text = dynamic_cast<SvgText *>(child.get())) {
+            LayoutElement(text, style, state);
+        }
+    }
+    const size_t characters = state.contexts.back().second;
+    state.contexts.pop_back();
+
+    ApplyTextLength(*element, style.font.size, firstRun, startX, characters, state);
+    if (textPath) {
+        EndTextPath(pathTable, *textPath, firstRun, outside, state);
+    }
+}
+
+void SvgText::ApplyTextLength(const SvgText &element, double fontSize, size_t firstRun, float startX,
+                              size_t characters, LayoutState &state) {
+    double textLength = 0.0;
+    if (characters == 0 || !ParseLength(element.textLength_, fontSize, state.viewPort.Width(), textLength) ||
+        textLength <= 0.0) {
+        return;
+    }
+    const float natural = state.x - startX;
+    if (element.lengthAdjust_ == "spacingAndGlyphs" && natural > 0.0f) {
+        const float scale = static_cast<float>(textLength) / natural;
+        for (size_t r = firstRun; r < runs_.size(); ++r) {
+            auto &run = runs_[r];
+            run.scaleX *= scale;
+            for (size_t i = 0; i < run.glyphs.size(); ++i) {
+                run.positions[2 * i] = startX + (run.positions[2 * i] - startX) * scale;
+                run.advances[i] *= scale;
+            }
+        }
+    } else {
+        const float gap = (static_cast<float>(textLength) - natural) / (characters > 1 ? characters - 1 : 1);
+        size_t index = 0;
+        for (size_t r = firstRun; r < runs_.size(); ++r) {
+            auto &run = runs_[r];
+            for (size_t i = 0; i < run.glyphs.size(); ++i, ++index) {
+                run.positions[2 * i] += gap * index;
+            }
+        }
+    }
+    state.x = startX + static_cast<float>(textLength);
+}
+
+const ArcLengthTable *SvgText::BeginTextPath(const SvgTextPath &textPath, double fontSize, LayoutState &state) {
+    EndChunk(state);
+    state.inChunk = false;
+    auto *node = context_ ? context_->GetSvgNodeByHandle(textPath.GetPathHandle()) : nullptr;
+    pathDependencies_.push_back({textPath.GetPathHandle(), node, node ? node->GetGeneration() : 0});
+    auto *path = dynamic_cast<SvgGraphic *>(node);
+    const ArcLengthTable *table = path ? &path->GetArcLengths() : nullptr;
+    // characters advance along the path from startOffset, y is the distance
+    // from the path
+    double offset = 0.0;
+    ParseLength(textPath.GetStartOffset(), fontSize, table ? vpToPx(table->Total()) : 0.0, offset);
+    state.x = static_cast<float>(offset);
+    state.y = 0.0f;
+    return table;
+}
+
+template <typename Sample>
+std::shared_ptr<OH_Drawing_Path> SvgText::BendGlyph(const GlyphRun &run, size_t index, float start, float offset,
+                                                    const Sample &sample) {
+    std::shared_ptr<OH_Drawing_Path> bent(OH_Drawing_PathCreate(), OH_Drawing_PathDestroy);
+    const float size = run.font->GetSpec().size;
+    const float scale = size / FontCache::GetSizeBucket(size);
+    auto outline = FontCache::GetInstance().GetGlyphPath(run.font->GetTypeface(), run.glyphs[index], size);
+    // the outline at the drawn size, x along the path from the glyph origin,
+    // y across it from the baseline
+    auto *glyph = OH_Drawing_PathCreate();
+    auto *matrix = OH_Drawing_MatrixCreate();
+    OH_Drawing_MatrixSetMatrix(matrix, scale * run.scaleX, 0.0f, 0.0f, 0.0f, scale, 0.0f, 0.0f, 0.0f, 1.0f);
+    OH_Drawing_PathAddPath(glyph, outline.get(), matrix);
+    auto *rect = OH_Drawing_RectCreate(0.0f, 0.0f, 0.0f, 0.0f);
+    OH_Drawing_PathGetBounds(glyph, rect);
+    const float left = OH_Drawing_RectGetLeft(rect);
+    const float right = OH_Drawing_RectGetRight(rect);
+    const float top = OH_Drawing_RectGetTop(rect) - 1.0f;
+    const float bottom = OH_Drawing_RectGetBottom(rect) + 1.0f;
+    OH_Drawing_RectDestroy(rect);
+    if (right > left) {
+        // each strip turns about its own point on the path, which bends the
+        // outline along the path's normals; strips overlap by a hairline so
+        // the seams do not show
+        const float stripWidth = STRETCH_STRIP_WIDTH * static_cast<float>(vpToPx(1.0));
+        const int strips = std::clamp(static_cast<int>(std::ceil((right - left) / stripWidth)), 1, MAX_STRETCH_STRIPS);
+        const float width = (right - left) / strips;
+        const float overlap = strips > 1 ? 0.25f : 0.0f;
+        for (int s = 0; s < strips; ++s) {
+            const float x0 = left + width * s;
+            const float center = x0 + width * 0.5f;
+            PathPoint point{};
+            float angle = 0.0f;
+            if (!sample(start + center, point, angle)) {
+                continue;
+            }
+            auto *strip = OH_Drawing_PathCreate();
+            OH_Drawing_PathAddRect(strip, x0 - overlap, top, x0 + width + overlap, bottom, PATH_DIRECTION_CW);
+            if (OH_Drawing_PathOp(strip, glyph, PATH_OP_MODE_INTERSECT)) {
+                const float radians = angle * DEG_TO_RAD;
+                const float cos = std::cos(radians);
+                const float sin = std::sin(radians);
+                OH_Drawing_MatrixSetMatrix(matrix, cos, -sin, point.x - cos * center - sin * offset, sin, cos,
+                                           point.y - sin * center + cos * offset, 0.0f, 0.0f, 1.0f);
+                OH_Drawing_PathAddPath(bent.get(), strip, matrix);
+            }
+            OH_Drawing_PathDestroy(strip);
+        }
+    }
+    OH_Drawing_MatrixDestroy(matrix);
+    OH_Drawing_PathDestroy(glyph);
+    return bent;
+}
+
+void SvgText::EndTextPath(const ArcLengthTable *table, const SvgTextPath &textPath, size_t firstRun,
+                          PathPoint outside, LayoutState &state) {
+    EndChunk(state);
+    state.inChunk = false;
+    const float pxPerUnit = static_cast<float>(vpToPx(1.0));
+    const float total = table ? table->Total() : 0.0f;
+    const bool reversed = textPath.IsReversed();
+    // point and direction at distance px along the way the text runs
+    auto sample = [&](float distance, PathPoint &point, float &angle) {
+        distance /= pxPerUnit;
+        if (!table || !SampleArcLength(*table, reversed ? total - distance : distance, point, angle)) {
+            return false;
+        }
+        if (reversed) {
+            angle += 180.0f;
+        }
+        point = {point.x * pxPerUnit, point.y * pxPerUnit};
+        return true;
+    };
+    // spacing="auto": path distance per px of gap at offset px from the path,
+    // so glyphs keep their natural gaps instead of fanning out on the outside
+    // of a bend and crowding on the inside
+    auto spacingScale = [&](float distance, float offset, float step) {
+        PathPoint point{};
+        float before = 0.0f;
+        float after = 0.0f;
+        if (!sample(distance - step, point, before) || !sample(distance + step, point, after)) {
+            return 1.0f;
+        }
+        const float turn = std::remainder(after - before, 360.0f) * DEG_TO_RAD;
+        const float stretch = 1.0f - turn / (2.0f * step) * offset;
+        return 1.0f / std::clamp(stretch, 1.0f / MAX_SPACING_SCALE, MAX_SPACING_SCALE);
+    };
+    PathPoint end = outside;
+    bool spaced = false;
+    float lastNatural = 0.0f;
+    float lastPlaced = 0.0f;
+    for (size_t r = firstRun; r < runs_.size(); ++r) {
+        auto &run = runs_[r];
+        if (run.rotations.empty()) {
+            run.rotations.assign(run.glyphs.size(), 0.0f);
+        }
+        if (textPath.IsStretched()) {
+            run.outlines.assign(run.glyphs.size(), nullptr);
+        }
+        const auto &metrics = run.font->GetMetrics();
+        const float middle = (metrics.ascent + metrics.descent) * 0.5f;
+        size_t kept = 0;
+        for (size_t i = 0; i < run.glyphs.size(); ++i) {
+            const float advance = run.advances[i];
+            const float offset = run.positions[2 * i + 1];
+            const float natural = run.positions[2 * i] + advance * 0.5f;
+            float distance = natural;
+            if (textPath.IsAutoSpacing() && spaced) {
+                const float step = std::max(advance * 0.5f, pxPerUnit);
+                distance = lastPlaced + (natural - lastNatural) * spacingScale(lastPlaced, offset + middle, step);
+            }
+            spaced = true;
+            lastNatural = natural;
+            lastPlaced = distance;
+            PathPoint point{};
+            float angle = 0.0f;
+            // glyphs whose middle falls off the path are not drawn
+            if (!sample(distance, point, angle)) {
+                continue;
+            }
+            const float radians = angle * DEG_TO_RAD;
+            const float cos = std::cos(radians);
+            const float sin = std::sin(radians);
+            const float x = point.x - cos * advance * 0.5f - sin * offset;
+            const float y = point.y - sin * advance * 0.5f + cos * offset;
+            if (textPath.IsStretched()) {
+                run.outlines[kept] = BendGlyph(run, i, distance - advance * 0.5f, offset, sample);
+            }
+            run.glyphs[kept] = run.glyphs[i];
+            run.advances[kept] = advance;
+            run.positions[2 * kept] = x;
+            run.positions[2 * kept + 1] = y;
+            run.rotations[kept] = run.rotations[i] + angle;
+            end = {x + cos * advance, y + sin * advance};
+            ++kept;
+        }
+        run.glyphs.resize(kept);
+        run.advances.resize(kept);
+        run.positions.resize(2 * kept);
+        run.rotations.resize(kept);
+        if (textPath.IsStretched()) {
+            run.outlines.resize(kept);
+        }
+    }
+    state.x = end.x;
+    state.y = end.y;
+}
+
+bool SvgText::ContainsTextPath() const {
+    for (const auto &child : children_) {
+        auto *text = dynamic_cast<const SvgText *>(child.get());
+        if (text && (dynamic_cast<const SvgTextPath *>(text) || text->ContainsTextPath())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t SvgText::GetReferencedGeneration() {
+    uint64_t generation = SvgGraphic::GetReferencedGeneration();
+    for (const auto &dependency : pathDependencies_) {
+        generation += GetHrefGeneration(dependency.handle);
+    }
+    return generation;
+}
+
+bool SvgText::PathsChanged() const {
+    for (const auto &dependency : pathDependencies_) {
+        auto *node = context_ ? context_->GetSvgNodeByHandle(dependency.handle) : nullptr;
+        if (node != dependency.node || (node && node->GetGeneration() != dependency.generation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SvgText::EndChunk(LayoutState &state) {
+    if (!state.inChunk || state.chunkAnchor == TextAnchor::START) {
+        return;
+    }
+    const float width = state.x - state.chunkStartX;
+    const float shift = state.chunkAnchor == TextAnchor::MIDDLE ? -width * 0.5f : -width;
+    for (size_t r = state.chunkRun; r < runs_.size(); ++r) {
+        auto &run = runs_[r];
+        for (size_t i = r == state.chunkRun ? state.chunkGlyph : 0; i < run.glyphs.size(); ++i) {
+            run.positions[2 * i] += shift;
+        }
+    }
+}
+
+void SvgText::BuildBlobs(GlyphRun &run) {
+    run.blobs.clear();
+    if (!run.outlines.empty()) {
+        return;
+    }
+    const bool perGlyph = !run.rotations.empty() || run.scaleX != 1.0f;
+    const size_t count = perGlyph ? 1 : run.glyphs.size();
+    for (size_t i = 0; i < run.glyphs.size(); i += count) {
+        auto *builder = OH_Drawing_TextBlobBuilderCreate();
+        const auto *buffer = OH_Drawing_TextBlobBuilderAllocRunPos(builder, run.font->Get(), count, nullptr);
+        for (size_t k = 0; k < count; ++k) {
+            buffer->glyphs[k] = run.glyphs[i + k];
+            buffer->pos[2 * k] = perGlyph ? 0.0f : run.positions[2 * (i + k)];
+            buffer->pos[2 * k + 1] = perGlyph ? 0.0f : run.positions[2 * (i + k) + 1];
+        }
+        run.blobs.emplace_back(OH_Drawing_TextBlobBuilderMake(builder), OH_Drawing_TextBlobDestroy);
+        OH_Drawing_TextBlobBuilderDestroy(builder);
+    }
+}
+
+void SvgText::DrawRun(OH_Drawing_Canvas *canvas, const GlyphRun &run) const {
+    if (!run.outlines.empty()) {
+        for (const auto &outline : run.outlines) {
+            OH_Drawing_CanvasDrawPath(canvas, outline.get());
+        }
+        return;
+    }
+    if (run.blobs.size() == 1 && run.rotations.empty() && run.scaleX == 1.0f) {
+        OH_Drawing_CanvasDrawTextBlob(canvas, run.blobs[0].get(), 0.0f, 0.0f);
+        return;
+    }
+    for (size_t i = 0; i < run.blobs.size(); ++i) {
+        OH_Drawing_CanvasSave(canvas);
+        OH_Drawing_CanvasTranslate(canvas, run.positions[2 * i], run.positions[2 * i + 1]);
+        if (!run.rotations.empty() && run.rotations[i] != 0.0f) {
+            OH_Drawing_CanvasRotate(canvas, run.rotations[i], 0.0f, 0.0f);
+        }
+        if (run.scaleX != 1.0f) {
+            OH_Drawing_CanvasScale(canvas, run.scaleX, 1.0f);
+        }
+        OH_Drawing_CanvasDrawTextBlob(canvas, run.blobs[i].get(), 0.0f, 0.0f);
+        OH_Drawing_CanvasRestore(canvas);
+    }
+}
+
+void SvgText::OnDraw(OH_Drawing_Canvas *canvas) {
+    if (!IsTextRoot()) {
+        return;
+    }
+    UpdateLayout();
+    for (const auto &run : runs_) {
+        auto *owner = run.owner;
+        if (owner->UpdateFillPattern(canvas) || owner->UpdateFillStyle()) {
+            OH_Drawing_CanvasAttachBrush(canvas, owner->fillBrush_);
+            DrawRun(canvas, run);
+            OH_Drawing_CanvasDetachBrush(canvas);
+        }
+        if (owner->UpdateStrokeStyle()) {
+            OH_Drawing_CanvasAttachPen(canvas, owner->strokePen_);
+            DrawRun(canvas, run);
+            OH_Drawing_CanvasDetachPen(canvas);
+        }
+    }
+}
+
+Rect SvgText::AsBounds() {
+    auto *root = this;
+    while (!root->IsTextRoot()) {
+        root = static_cast<SvgText *>(root->parent_);
+    }
+    root->UpdateLayout();
+    return root == this ? layoutBounds_ : root->GetRunBounds(this);
+}
+
+Rect SvgText::GetRunBounds(const SvgText *element) const {
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 0.0f;
+    float bottom = 0.0f;
+    bool empty = true;
+    for (const auto &run : runs_) {
+        if (element && !run.owner->IsWithin(element)) {
+            continue;
+        }
+        const auto &metrics = run.font->GetMetrics();
+        for (size_t i = 0; i < run.glyphs.size(); ++i) {
+            const float x = run.positions[2 * i];
+            const float y = run.positions[2 * i + 1];
+            left = empty ? x : std::min(left, x);
+            right = empty ? x + run.advances[i] : std::max(right, x + run.advances[i]);
+            top = empty ? y + metrics.ascent : std::min(top, y + metrics.ascent);
+            bottom = empty ? y + metrics.descent : std::max(bottom, y + metrics.descent);
+            empty = false;
+        }
+    }
+    return Rect(left, top, right - left, bottom - top);
+}
+
+bool SvgText::IsWithin(const SvgText *element) const {
+    for (auto *text = this; text; text = dynamic_cast<const SvgText *>(text->parent_)) {
+        if (text == element) {
+            return true;
+        }
+    }
+    return false;
+}
+
+OH_Drawing_Path *SvgText::AsPath() const {
+    auto *path = OH_Drawing_PathCreate();
+    const auto *root = this;
+    while (!root->IsTextRoot()) {
+        root = static_cast<const SvgText *>(root->parent_);
+    }
+    auto &cache = FontCache::GetInstance();
+    auto *matrix = OH_Drawing_MatrixCreate();
+    for (const auto &run : root->runs_) {
+        if (!run.owner->IsWithin(this)) {
+            continue;
+        }
+        const float size = run.font->GetSpec().size;
+        const float scale = size / FontCache::GetSizeBucket(size);
+        if (!run.outlines.empty()) {
+            for (const auto &outline : run.outlines) {
+                OH_Drawing_PathAddPath(path, outline.get(), nullptr);
+            }
+            continue;
+        }
+        for (size_t i = 0; i < run.glyphs.size(); ++i) {
+            auto outline = cache.GetGlyphPath(run.font->GetTypeface(), run.glyphs[i], size);
+            const float radians = run.rotations.empty() ? 0.0f : run.rotations[i] * DEG_TO_RAD;
+            const float cos = std::cos(radians);
+            const float sin = std::sin(radians);
+            const float sx = scale * run.scaleX;
+            OH_Drawing_MatrixSetMatrix(matrix, cos * sx, -sin * scale, run.positions[2 * i], sin * sx, cos * scale,
+                                       run.positions[2 * i + 1], 0.0f, 0.0f, 1.0f);
+            OH_Drawing_PathAddPath(path, outline.get(), matrix);
+        }
+    }
+    OH_Drawing_MatrixDestroy(matrix);
+    return path;
+}
+
+bool SvgText::HashContent(WideHash &seed) const {
+    HashCombine(seed, content_);
+    for (const auto *value : {&font_.family, &font_.size, &font_.weight, &font_.style, &font_.stretch, &font_.textAnchor,
+                              &font_.letterSpacing, &font_.wordSpacing, &textLength_, &lengthAdjust_,
+                              &baselineShift_, &alignmentBaseline_}) {
+        HashCombine(seed, *value);
+    }
+    for (const auto *list : {&x_, &y_, &dx_, &dy_, &rotate_}) {
+        HashCombine(seed, list->size());
+        for (const auto &value : *list) {
+            HashCombine(seed, value);
+        }
+    }
+    return SvgGraphic::HashContent(seed);
+}
+
+} // namespace rnoh
@@ -0,0 +1,170 @@
+#pragma once
+#include <native_drawing/drawing_text_blob.h>
+#include <memory>
+#include "SvgGraphic.h"
+#include "utils/TextShaper.h"
+
+namespace rnoh {
+
+class SvgTextPath;
+
+// Font attributes as set on a text element, empty values inherit.
+struct SvgFontAttributes {
+    std::string family;
+    std::string size;
+    std::string weight;
+    std::string style;
+    std::string stretch;
+    std::string textAnchor;
+    std::string letterSpacing;
+    std::string wordSpacing;
+
+    bool operator==(const SvgFontAttributes &other) const {
+        return family == other.family && size == other.size && weight == other.weight && style == other.style &&
+               stretch == other.stretch && textAnchor == other.textAnchor && letterSpacing == other.letterSpacing &&
+               wordSpacing == other.wordSpacing;
+    }
+};
+
+// <text> and the base of the elements nested in it. The outermost text
+// element lays out the characters of its whole subtree and draws them with
+// the fill and stroke of the element each character belongs to.
+//
+// Layout is kept until a font, content or positioning attribute in the
+// subtree changes; paint changes only redraw the cached glyph runs. Each
+// element also keeps its shaped glyphs until its own font or content changes,
+// so moving text around does not shape it again.
+class SvgText : public SvgGraphic {
+public:
+    SvgText() = default;
+    ~SvgText() override = default;
+
+    void SetFont(const SvgFontAttributes &font);
+    // x, y, dx, dy and rotate lists, one entry per character
+    void SetPositions(const std::vector<std::string> &x, const std::vector<std::string> &y,
+                      const std::vector<std::string> &dx, const std::vector<std::string> &dy,
+                      const std::vector<std::string> &rotate);
+    void SetTextLength(const std::string &textLength, const std::string &lengthAdjust);
+    void SetBaseline(const std::string &baselineShift, const std::string &alignmentBaseline);
+
+    // Text related props shared by RNSVGText, RNSVGTSpan and RNSVGTextPath.
+    template <typename T>
+    void SetTextProps(const T &props) {
+        const auto &font = props.font;
+        SetFont({font.fontFamily, font.fontSize.empty() ? props.fontSize : font.fontSize,
+                 font.fontWeight.empty() ? props.fontWeight : font.fontWeight, font.fontStyle, font.fontStretch,
+                 font.textAnchor, font.letterSpacing, font.wordSpacing});
+        SetPositions(props.x, props.y, props.dx, props.dy, props.rotate);
+        SetTextLength(props.textLength, props.lengthAdjust);
+        SetBaseline(props.baselineShift, props.alignmentBaseline);
+    }
+
+    void OnAppendChild(const std::shared_ptr<SvgNode> &child) override;
+    void OnRemoveChild(const std::shared_ptr<SvgNode> &child) override;
+
+    void OnDraw(OH_Drawing_Canvas *canvas) override;
+    // The glyph boxes of this element and its descendants.
+    Rect AsBounds() override;
+    // Glyph outlines of this element and its descendants as of the last
+    // layout, for clipping to text.
+    OH_Drawing_Path *AsPath() const override;
+    // Lays out the subtree when this is the outermost text element.
+    void PrepareGeometry() override;
+    // Adds the paths text is laid out along.
+    uint64_t GetReferencedGeneration() override;
+
+protected:
+    using TextBlobPtr = std::unique_ptr<OH_Drawing_TextBlob, void (*)(OH_Drawing_TextBlob *)>;
+
+    // Consecutive glyphs of one element, positions in px of the root's user
+    // space.
+    struct GlyphRun {
+        SvgText *owner = nullptr;
+        std::shared_ptr<TextFont> font;
+        std::vector<uint16_t> glyphs;
+        std::vector<float> advances;
+        // x, y pairs of the glyph origins
+        std::vector<float> positions;
+        // degrees per glyph, empty when no glyph is rotated
+        std::vector<float> rotations;
+        float scaleX = 1.0f;
+        // one blob for the run, or one per glyph at the origin when glyphs
+        // are rotated or stretched
+        std::vector<TextBlobPtr> blobs;
+        // glyph outlines bent along a path by method="stretch", in px of the
+        // root's user space; drawn instead of the blobs when present
+        std::vector<std::shared_ptr<OH_Drawing_Path>> outlines;
+    };
+
+    struct LayoutState;
+    struct ResolvedStyle;
+
+    // Marks the layout of the outermost text element stale.
+    void InvalidateLayout();
+    bool IsTextRoot() const;
+    // true for element itself and the elements nested in it
+    bool IsWithin(const SvgText *element) const;
+    // union of the glyph boxes of element's subtree, all runs for nullptr
+    Rect GetRunBounds(const SvgText *element) const;
+    void UpdateLayout();
+    void LayoutElement(SvgText *element, const ResolvedStyle &parent, LayoutState &state);
+    void EndChunk(LayoutState &state);
+    void ApplyTextLength(const SvgText &element, double fontSize, size_t firstRun, float startX, size_t characters,
+                         LayoutState &state);
+    // Starts laying out along the path of textPath, nullptr when it has none.
+    const ArcLengthTable *BeginTextPath(const SvgTextPath &textPath, double fontSize, LayoutState &state);
+    // Maps the glyphs laid out since firstRun from path distances onto table.
+    void EndTextPath(const ArcLengthTable *table, const SvgTextPath &textPath, size_t firstRun, PathPoint outside,
+                     LayoutState &state);
+    // Outline of glyph index of run bent along the path from distance start,
+    // sample maps a distance to a point and direction as in EndTextPath.
+    template <typename Sample>
+    std::shared_ptr<OH_Drawing_Path> BendGlyph(const GlyphRun &run, size_t index, float start, float offset,
+                                               const Sample &sample);
+    bool ContainsTextPath() const;
+    // true when a path the layout was placed on changed or was replaced
+    bool PathsChanged() const;
+    void DrawRun(OH_Drawing_Canvas *canvas, const GlyphRun &run) const;
+    static void BuildBlobs(GlyphRun &run);
+
+    bool HashContent(WideHash &seed) const override;
+    // glyph runs are drawn by OnDraw()
+    bool PrepareFlatDraw(SvgDrawRecord &record) override { return false; }
+
+    // characters of this element itself, set by <tspan>
+    std::u32string content_;
+    // false once content_ or the font changed since it was shaped
+    bool shapedValid_ = false;
+
+private:
+    SvgFontAttributes font_;
+    std::vector<std::string> x_;
+    std::vector<std::string> y_;
+    std::vector<std::string> dx_;
+    std::vector<std::string> dy_;
+    std::vector<std::string> rotate_;
+    std::string textLength_;
+    std::string lengthAdjust_;
+    std::string baselineShift_;
+    std::string alignmentBaseline_;
+
+    // shaped content_, redone when the resolved font or the content changes
+    std::shared_ptr<TextFont> shapedFont_;
+    std::vector<uint16_t> shapedGlyphs_;
+    std::vector<float> shapedAdvances_;
+
+    // laid out subtree, outermost element only
+    uint64_t layoutVersion_ = 1;
+    uint64_t laidOutVersion_ = 0;
+    Size laidOutViewPort_;
+    std::vector<GlyphRun> runs_;
+    Rect layoutBounds_;
+    struct PathDependency {
+        SvgIdHandle handle;
+        const SvgNode *node;
+        uint64_t generation;
+    };
+    std::vector<PathDependency> pathDependencies_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,62 @@
+#pragma once
+#include "SvgText.h"
+
+namespace rnoh {
+
+// <textPath>, its characters are laid out along the referenced path by the
+// enclosing <text>.
+class SvgTextPath : public SvgText {
+public:
+    SvgTextPath() = default;
+    ~SvgTextPath() override = default;
+
+    void SetPathRef(const std::string &id) {
+        if (id == pathRef_) {
+            return;
+        }
+        pathRef_ = id;
+        BindRef(hrefPath_, id);
+        InvalidateLayout();
+    }
+
+    // side="right" walks the path backwards, method="stretch" bends the
+    // glyph outlines along it and spacing="auto" evens out the gaps between
+    // glyphs where the path curves.
+    void SetPlacement(const std::string &startOffset, const std::string &side, const std::string &method,
+                      const std::string &spacing) {
+        if (startOffset == startOffset_ && side == side_ && method == method_ && spacing == spacing_) {
+            return;
+        }
+        startOffset_ = startOffset;
+        side_ = side;
+        method_ = method;
+        spacing_ = spacing;
+        InvalidateLayout();
+    }
+
+    SvgIdHandle GetPathHandle() const { return hrefPath_; }
+    const std::string &GetStartOffset() const { return startOffset_; }
+    bool IsReversed() const { return side_ == "right"; }
+    bool IsStretched() const { return method_ == "stretch"; }
+    bool IsAutoSpacing() const { return spacing_ == "auto"; }
+
+protected:
+    bool HashContent(WideHash &seed) const override {
+        HashRef(seed, hrefPath_);
+        HashCombine(seed, startOffset_);
+        HashCombine(seed, side_);
+        HashCombine(seed, method_);
+        HashCombine(seed, spacing_);
+        return SvgText::HashContent(seed);
+    }
+
+private:
+    std::string pathRef_;
+    SvgIdHandle hrefPath_ = SVG_ID_NONE;
+    std::string startOffset_;
+    std::string side_;
+    std::string method_;
+    std::string spacing_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,99 @@
+#include "SvgThumbnailBatch.h"
+#include <algorithm>
+#include <numeric>
+#include "utils/WorkerPool.h"
+
+namespace rnoh {
+
+ThumbnailBatch::ThumbnailBatch(std::vector<ThumbnailRequest> requests, const ThumbnailBatchLimits& limits,
+                               ResultCallback onResult, DoneCallback onDone)
+    : requests_(std::move(requests)),
+      maxConcurrent_(limits.maxConcurrent > 0 ? limits.maxConcurrent
+                                              : std::max<size_t>(WorkerPool::GetInstance().GetThreadCount(), 2) - 1),
+      memoryBudget_(limits.memoryBudget), remaining_(requests_.size()), onResult_(std::move(onResult)),
+      onDone_(std::move(onDone))
+{
+    order_.resize(requests_.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(order_.begin(), order_.end(),
+                     [this](size_t a, size_t b) { return requests_[a].priority < requests_[b].priority; });
+}
+
+std::shared_ptr<ThumbnailBatch> ThumbnailBatch::Start(std::vector<ThumbnailRequest> requests,
+                                                      const ThumbnailBatchLimits& limits, ResultCallback onResult,
+                                                      DoneCallback onDone)
+{
+    auto batch = std::make_shared<ThumbnailBatch>(std::move(requests), limits, std::move(onResult), std::move(onDone));
+    if (batch->requests_.empty()) {
+        batch->onResult_ = nullptr;
+        batch->onDone_();
+        return batch;
+    }
+    std::lock_guard<std::mutex> lock(batch->mutex_);
+    batch->Schedule();
+    return batch;
+}
+
+void ThumbnailBatch::Cancel()
+{
+    std::vector<size_t> skipped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        skipped.assign(order_.begin() + next_, order_.end());
+        next_ = order_.size();
+    }
+    for (size_t index : skipped) {
+        Report(index, "");
+    }
+}
+
+void ThumbnailBatch::Schedule()
+{
+    auto self = shared_from_this();
+    while (!cancelled_ && next_ < order_.size() && running_ < maxConcurrent_) {
+        const size_t index = order_[next_];
+        auto svg = SvgSvg::FindDocument(requests_[index].tag);
+        const size_t bytes = svg ? EstimateSnapshotBytes(*svg, requests_[index].options) : 0;
+        if (running_ > 0 && bytesInFlight_ + bytes > memoryBudget_) {
+            // admitted again as running snapshots release their memory
+            return;
+        }
+        ++next_;
+        ++running_;
+        bytesInFlight_ += bytes;
+        WorkerPool::GetInstance().Post(
+            [self, index, svg = std::move(svg), bytes]() mutable { self->Run(index, std::move(svg), bytes); });
+    }
+}
+
+void ThumbnailBatch::Run(size_t index, std::shared_ptr<SvgSvg> svg, size_t bytes)
+{
+    std::string base64;
+    if (svg && bytes > 0) {
+        base64 = SnapshotToBase64(*svg, requests_[index].options);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --running_;
+        bytesInFlight_ -= bytes;
+        Schedule();
+    }
+    Report(index, std::move(base64));
+}
+
+void ThumbnailBatch::Report(size_t index, std::string base64)
+{
+    onResult_(index, std::move(base64));
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done = --remaining_ == 0;
+    }
+    if (done) {
+        onResult_ = nullptr;
+        onDone_();
+    }
+}
+
+} // namespace rnoh
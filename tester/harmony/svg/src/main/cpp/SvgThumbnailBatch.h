@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "SvgSnapshot.h"
+
+namespace rnoh {
+
+struct ThumbnailRequest {
+    // React tag of the mounted RNSVGSvgView
+    int32_t tag = 0;
+    SnapshotOptions options;
+    // lower runs first, e.g. 0 for items on screen
+    int32_t priority = 0;
+};
+
+struct ThumbnailBatchLimits {
+    // snapshots encoding at once, 0 for all pool threads but one, which stays
+    // free for frame prepares and image decodes
+    size_t maxConcurrent = 0;
+    // peak bytes of all snapshots in flight; one over budget still runs alone
+    size_t memoryBudget = 64 * 1024 * 1024;
+};
+
+// Rasterizes many documents through SnapshotToBase64 on the shared
+// WorkerPool. Requests start in priority order, the order they were given
+// within a priority, and only while the batch stays under its concurrency
+// and memory limits, so a gallery's thumbnails neither flood the pool ahead
+// of frame preparation nor hold hundreds of bands at once. Each result is
+// reported as soon as it is encoded, from whichever worker encoded it, so
+// onResult must be safe to call concurrently.
+class ThumbnailBatch : public std::enable_shared_from_this<ThumbnailBatch> {
+public:
+    // index into the requests, base64 empty when the document is gone or
+    // could not be rendered
+    using ResultCallback = std::function<void(size_t index, std::string base64)>;
+    using DoneCallback = std::function<void()>;
+
+    // onDone is called once after the last result, after onResult has been
+    // released.
+    static std::shared_ptr<ThumbnailBatch> Start(std::vector<ThumbnailRequest> requests,
+                                                 const ThumbnailBatchLimits& limits, ResultCallback onResult,
+                                                 DoneCallback onDone);
+
+    // Requests not started yet are reported with empty results.
+    void Cancel();
+
+    ThumbnailBatch(std::vector<ThumbnailRequest> requests, const ThumbnailBatchLimits& limits,
+                   ResultCallback onResult, DoneCallback onDone);
+
+private:
+    // Posts the next requests the limits allow, mutex_ held.
+    void Schedule();
+    void Run(size_t index, std::shared_ptr<SvgSvg> svg, size_t bytes);
+    void Report(size_t index, std::string base64);
+
+    std::mutex mutex_;
+    std::vector<ThumbnailRequest> requests_;
+    // request indices by priority, next_ is the first not started
+    std::vector<size_t> order_;
+    size_t next_ = 0;
+    size_t maxConcurrent_;
+    size_t memoryBudget_;
+    size_t running_ = 0;
+    size_t bytesInFlight_ = 0;
+    size_t remaining_;
+    bool cancelled_ = false;
+    ResultCallback onResult_;
+    DoneCallback onDone_;
+};
+
+} // namespace rnoh
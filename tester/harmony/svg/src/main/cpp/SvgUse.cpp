@@ -0,0 +1,57 @@
+#include "SvgUse.h"
+#include "SvgSymbol.h"
+
+namespace rnoh {
+
+void SvgUse::OnDraw(OH_Drawing_Canvas* canvas)
+{
+    auto* target = context_->GetSvgNodeByHandle(attributes_.href);
+    if (!target || drawing_) {
+        return;
+    }
+    drawing_ = true;
+    OH_Drawing_CanvasSave(canvas);
+    OH_Drawing_CanvasTranslate(canvas, vpToPx(x_), vpToPx(y_));
+    if (auto* symbol = dynamic_cast<SvgSymbol*>(target)) {
+        const auto& viewBox = context_->GetRootViewBox();
+        const double width = width_ > 0.0 ? width_ : viewBox.Width();
+        const double height = height_ > 0.0 ? height_ : viewBox.Height();
+        symbol->DrawInstance(canvas, vpToPx(width), vpToPx(height));
+    } else {
+        target->DrawRecorded(canvas);
+    }
+    OH_Drawing_CanvasRestore(canvas);
+    drawing_ = false;
+}
+
+Rect SvgUse::AsBounds()
+{
+    auto* target = context_ ? context_->GetSvgNodeByHandle(attributes_.href) : nullptr;
+    if (!target || drawing_ || dynamic_cast<SvgSymbol*>(target)) {
+        return Rect(vpToPx(x_), vpToPx(y_), vpToPx(width_), vpToPx(height_));
+    }
+    drawing_ = true;
+    // the target draws with its own transform
+    auto bounds = target->GetTransform().MapRect(target->AsBounds());
+    drawing_ = false;
+    return Rect(bounds.Left() + vpToPx(x_), bounds.Top() + vpToPx(y_), bounds.Width(), bounds.Height());
+}
+
+double SvgUse::GetPaintOutset()
+{
+    auto* target = context_ ? context_->GetSvgNodeByHandle(attributes_.href) : nullptr;
+    if (!target || drawing_ || dynamic_cast<SvgSymbol*>(target)) {
+        return SvgNode::GetPaintOutset();
+    }
+    drawing_ = true;
+    const double outset = target->GetPaintOutset() * target->GetTransform().GetMaxScale();
+    drawing_ = false;
+    return outset;
+}
+
+uint64_t SvgUse::GetReferencedGeneration()
+{
+    return GetHrefGeneration(attributes_.href) + SvgNode::GetReferencedGeneration();
+}
+
+} // namespace rnoh
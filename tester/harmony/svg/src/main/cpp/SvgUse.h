@@ -0,0 +1,38 @@
+#pragma once
+#include "SvgNode.h"
+
+namespace rnoh {
+
+// Instance of the element referenced by href, see SetHref.
+class SvgUse : public SvgNode {
+public:
+    SvgUse() = default;
+    ~SvgUse() override = default;
+
+    // user units, as sent by RNSVG
+    double x_ = 0.0;
+    double y_ = 0.0;
+    // 0 when unset, the referenced symbol then fills 100%
+    double width_ = 0.0;
+    double height_ = 0.0;
+
+    void OnDraw(OH_Drawing_Canvas* canvas) override;
+    Rect AsBounds() override;
+    double GetPaintOutset() override;
+    uint64_t GetReferencedGeneration() override;
+
+protected:
+    bool HashContent(WideHash& seed) const override
+    {
+        for (double value : {x_, y_, width_, height_}) {
+            HashCombine(seed, value);
+        }
+        return true;
+    }
+
+private:
+    // guards href cycles, e.g. a <use> inside the group it references
+    bool drawing_ = false;
+};
+
+} // namespace rnoh
@@ -0,0 +1,44 @@
+#pragma once
+
+// This file was generated.
+
+#include "RNOHCorePackage/ComponentBinders/ViewComponentJSIBinder.h"
+
+namespace rnoh {
+class RNSVGAnimateJSIBinder : public ViewComponentJSIBinder {
+  protected:
+    facebook::jsi::Object createNativeProps(facebook::jsi::Runtime &rt) override {
+        auto object = ViewComponentJSIBinder::createNativeProps(rt);
+        object.setProperty(rt, "name", true);
+        object.setProperty(rt, "element", true);
+        object.setProperty(rt, "attributeName", true);
+        object.setProperty(rt, "begin", true);
+        object.setProperty(rt, "dur", true);
+        object.setProperty(rt, "end", true);
+        object.setProperty(rt, "repeatCount", true);
+        object.setProperty(rt, "fill", true);
+        object.setProperty(rt, "calcMode", true);
+        object.setProperty(rt, "values", true);
+        object.setProperty(rt, "keyTimes", true);
+        object.setProperty(rt, "keySplines", true);
+        object.setProperty(rt, "keyPoints", true);
+        object.setProperty(rt, "from", true);
+        object.setProperty(rt, "to", true);
+        object.setProperty(rt, "path", true);
+        object.setProperty(rt, "rotate", true);
+        object.setProperty(rt, "type", true);
+        object.setProperty(rt, "href", true);
+        return object;
+    }
+
+    facebook::jsi::Object createBubblingEventTypes(facebook::jsi::Runtime &rt) override {
+        facebook::jsi::Object events(rt);
+        return events;
+    }
+
+    facebook::jsi::Object createDirectEventTypes(facebook::jsi::Runtime &rt) override {
+        facebook::jsi::Object events(rt);
+        return events;
+    }
+};
+} // namespace rnoh
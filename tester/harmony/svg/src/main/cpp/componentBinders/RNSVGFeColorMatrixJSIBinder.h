@@ -0,0 +1,33 @@
+#pragma once
+
+// This file was generated.
+
+#include "RNOHCorePackage/ComponentBinders/ViewComponentJSIBinder.h"
+
+namespace rnoh {
+class RNSVGFeColorMatrixJSIBinder : public ViewComponentJSIBinder {
+  protected:
+    facebook::jsi::Object createNativeProps(facebook::jsi::Runtime &rt) override {
+        auto object = ViewComponentJSIBinder::createNativeProps(rt);
+        object.setProperty(rt, "x", true);
+        object.setProperty(rt, "y", true);
+        object.setProperty(rt, "width", true);
+        object.setProperty(rt, "height", true);
+        object.setProperty(rt, "result", true);
+        object.setProperty(rt, "in1", true);
+        object.setProperty(rt, "type", true);
+        object.setProperty(rt, "values", true);
+        return object;
+    }
+
+    facebook::jsi::Object createBubblingEventTypes(facebook::jsi::Runtime &rt) override {
+        facebook::jsi::Object events(rt);
+        return events;
+    }
+
+    facebook::jsi::Object createDirectEventTypes(facebook::jsi::Runtime &rt) override {
+        facebook::jsi::Object events(rt);
+        return events;
+    }
+};
+} // namespace rnoh
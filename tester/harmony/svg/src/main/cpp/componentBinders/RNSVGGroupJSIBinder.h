@@ -13,6 +13,7 @@ class RNSVGGroupJSIBinder : public ViewComponentJSIBinder {
         object.setProperty(rt, "opacity", true);
         object.setProperty(rt, "matrix", true);
         object.setProperty(rt, "mask", true);
+        object.setProperty(rt, "filter", true);
         object.setProperty(rt, "markerStart", true);
         object.setProperty(rt, "markerMid", true);
         object.setProperty(rt, "markerEnd", true);
@@ -19,10 +19,18 @@ class RNSVGSvgViewJSIBinder : public ViewComponentJSIBinder {
         object.setProperty(rt, "meetOrSlice", true);
         object.setProperty(rt, "tintColor", true);
         object.setProperty(rt, "color", true);
+        object.setProperty(rt, "renderMode", "string");
 //         object.setProperty(rt, "pointerEvents", true);
         return object;
     }
 
+    // dispatched to RNSVGSvgViewComponentInstance::handleCommand
+    facebook::jsi::Object createCommands(facebook::jsi::Runtime &rt) override {
+        facebook::jsi::Object commands(rt);
+        commands.setProperty(rt, "setNativeProps", "setNativeProps");
+        return commands;
+    }
+
     facebook::jsi::Object createBubblingEventTypes(facebook::jsi::Runtime &rt) override {
         facebook::jsi::Object events(rt);
         return events;
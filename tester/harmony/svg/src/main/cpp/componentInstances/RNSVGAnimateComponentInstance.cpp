@@ -0,0 +1,62 @@
+#include "RNSVGAnimateComponentInstance.h"
+#include "Props.h"
+#include "properties/SvgDomType.h"
+#include <react/renderer/core/ConcreteState.h>
+
+namespace rnoh {
+
+namespace {
+SvgAnimateType GetAnimateType(const std::string &element) {
+    if (element == "set") {
+        return SvgAnimateType::SET;
+    }
+    if (element == "animateTransform") {
+        return SvgAnimateType::ANIMATE_TRANSFORM;
+    }
+    if (element == "animateMotion") {
+        return SvgAnimateType::ANIMATE_MOTION;
+    }
+    return SvgAnimateType::ANIMATE;
+}
+} // namespace
+
+RNSVGAnimateComponentInstance::RNSVGAnimateComponentInstance(Context context)
+    : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgAnimate>(SvgAnimateType::ANIMATE), getTag());
+}
+
+void RNSVGAnimateComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgAnimate = std::dynamic_pointer_cast<SvgAnimate>(GetSvgNode());
+    svgAnimate->SetId(props->name);
+    svgAnimate->SetType(GetAnimateType(props->element));
+    // an absent begin starts with the document, not never
+    const std::pair<const char *, std::string> attrs[] = {
+        {DOM_SVG_ANIMATION_ATTRIBUTE_NAME, props->attributeName},
+        {DOM_SVG_ANIMATION_BEGIN, props->begin.empty() ? "0s" : props->begin},
+        {DOM_SVG_ANIMATION_DUR, props->dur},
+        {DOM_SVG_ANIMATION_END, props->end},
+        {DOM_SVG_ANIMATION_REPEAT_COUNT, props->repeatCount},
+        {DOM_SVG_ANIMATION_FILL, props->fill},
+        {DOM_SVG_ANIMATION_CALC_MODE, props->calcMode},
+        {DOM_SVG_ANIMATION_VALUES, props->values},
+        {DOM_SVG_ANIMATION_KEY_TIMES, props->keyTimes},
+        {DOM_SVG_ANIMATION_KEY_SPLINES, props->keySplines},
+        {DOM_SVG_ANIMATION_KEY_POINTS, props->keyPoints},
+        {DOM_SVG_ANIMATION_FROM, props->from},
+        {DOM_SVG_ANIMATION_TO, props->to},
+        {DOM_SVG_ANIMATION_PATH, props->path},
+        {DOM_SVG_ANIMATION_ROTATE, props->rotate},
+        {DOM_SVG_ANIMATION_TYPE, props->type},
+        {DOM_SVG_HREF, props->href},
+    };
+    for (const auto &[name, value] : attrs) {
+        svgAnimate->SetAttr(name, value);
+    }
+    svgAnimate->MarkDirty();
+}
+
+SvgArkUINode &RNSVGAnimateComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -0,0 +1,28 @@
+#pragma once
+#include "RNOH/CppComponentInstance.h"
+#include <folly/dynamic.h>
+#include "SvgArkUINode.h"
+#include "ShadowNodes.h"
+#include "SvgAnimate.h"
+
+namespace rnoh {
+
+// <animate>, <set>, <animateTransform> and <animateMotion>, told apart by the
+// element prop. Animates its parent, or the element its href names.
+class RNSVGAnimateComponentInstance : public CppComponentInstance<facebook::react::RNSVGAnimateShadowNode>,
+                                      public SvgHost {
+private:
+    SvgArkUINode m_svgArkUINode;
+
+public:
+    RNSVGAnimateComponentInstance(Context context);
+
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override {}
+
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override {}
+
+    SvgArkUINode &getLocalRootArkUINode() override;
+
+    void onPropsChanged(SharedConcreteProps const &props) override;
+};
+} // namespace rnoh
@@ -6,26 +6,36 @@
 namespace rnoh {
 
 RNSVGCircleComponentInstance::RNSVGCircleComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgCircle>(), getTag());
 }
 
 void RNSVGCircleComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
     CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[RNSVGCircleComponentInstance] cx: " << props->cx;
     LOG(INFO) << "[RNSVGCircleComponentInstance] cy: " << props->cy;
     LOG(INFO) << "[RNSVGCircleComponentInstance] r: " << props->r;
-    LOG(INFO) << "[RNSVGCircleComponentInstance] r: " << props->opacity;
-    LOG(INFO) << "[RNSVGCircleComponentInstance] fill.payload: " << (uint32_t)*props->fill.payload ;
     // set attribute to svgCircle.
     auto svgCircle = std::dynamic_pointer_cast<SvgCircle>(GetSvgNode());
+    svgCircle->SetId(props->name);
+    svgCircle->SetClipPathRef(props->clipPath);
+    svgCircle->SetMaskRef(props->mask);
+    svgCircle->SetTransform(props->matrix);
+    svgCircle->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgCircle->SetOpacity(props->opacity);
     svgCircle->x = std::stof(props->cx);
     svgCircle->y = std::stof(props->cy);
     svgCircle->r = std::stof(props->r);
-    //透明度穿0.0-1.0 ，需要乘以100转换
-    svgCircle->opacity = props->opacity*100;
-    //颜色需要转换
-    svgCircle->colorFill = (uint32_t)*props->fill.payload;
-   
+    svgCircle->setBrushColor((uint32_t)*props->fill.payload, props->fillOpacity);
+    svgCircle->setStrokColor((uint32_t)*props->stroke.payload);
+    svgCircle->setStrokeLineWith(props->strokeWidth);
+    svgCircle->setStrokeDasharray(props->strokeDasharray);
+    svgCircle->setStrokeDashoffset(props->strokeDashoffset);
+    svgCircle->setStrokeLineCap(props->strokeLinecap);
+    svgCircle->setStrokeLineJoin(props->strokeLinejoin);
+    svgCircle->setStrokeMiterlimit(props->strokeMiterlimit);
+    svgCircle->setStrokeOpacity(props->strokeOpacity);
+    svgCircle->MarkDirty();
 }
 
 SvgArkUINode &RNSVGCircleComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
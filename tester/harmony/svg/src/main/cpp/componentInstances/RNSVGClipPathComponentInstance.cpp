@@ -6,11 +6,16 @@
 namespace rnoh {
 
 RNSVGClipPathComponentInstance::RNSVGClipPathComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgClipPath>(), getTag());
 }
 
 void RNSVGClipPathComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgClipPath = std::dynamic_pointer_cast<SvgClipPath>(GetSvgNode());
+    svgClipPath->SetId(props->name);
+    svgClipPath->SetTransform(props->matrix);
+    svgClipPath->MarkDirty();
 }
 
 SvgArkUINode &RNSVGClipPathComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
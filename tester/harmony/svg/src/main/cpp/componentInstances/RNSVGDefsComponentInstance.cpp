@@ -6,7 +6,7 @@
 namespace rnoh {
 
 RNSVGDefsComponentInstance::RNSVGDefsComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgDefs>(), getTag());
 }
 
 void RNSVGDefsComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
@@ -6,21 +6,28 @@
 namespace rnoh {
 
 RNSVGEllipseComponentInstance::RNSVGEllipseComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgEllipse>());
+    SetSvgNode(std::make_shared<SvgEllipse>(), getTag());
 }
 
 void RNSVGEllipseComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[SvgEllipse] cx: " << props->cx;
     LOG(INFO) << "[SvgEllipse] cy: " << props->cy;
     LOG(INFO) << "[SvgEllipse] rx: " << props->rx;
     LOG(INFO) << "[SvgEllipse] ry: " << props->ry;
     auto svgEllipse = std::dynamic_pointer_cast<SvgEllipse>(GetSvgNode());
+    svgEllipse->SetId(props->name);
+    svgEllipse->SetClipPathRef(props->clipPath);
+    svgEllipse->SetMaskRef(props->mask);
+    svgEllipse->SetTransform(props->matrix);
+    svgEllipse->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
     svgEllipse->cx = std::stof(props->cx);
     svgEllipse->cy = std::stof(props->cy);
     svgEllipse->rx = std::stof(props->rx);
     svgEllipse->ry = std::stof(props->ry);
     svgEllipse->colorFill = (uint32_t)*props->fill.payload;
+    svgEllipse->MarkDirty();
 }
 
 SvgArkUINode &RNSVGEllipseComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
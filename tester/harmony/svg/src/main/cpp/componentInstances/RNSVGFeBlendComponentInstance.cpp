@@ -0,0 +1,35 @@
+#include "RNSVGFeBlendComponentInstance.h"
+#include "Props.h"
+#include "properties/SvgDomType.h"
+#include <react/renderer/core/ConcreteState.h>
+
+namespace rnoh {
+
+RNSVGFeBlendComponentInstance::RNSVGFeBlendComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgFeBlend>(), getTag());
+}
+
+void RNSVGFeBlendComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgFe = std::dynamic_pointer_cast<SvgFeBlend>(GetSvgNode());
+    // the subregion defaults to the filter region, in to the previous result
+    const std::pair<const char *, std::string> attrs[] = {
+        {DOM_SVG_X, props->x.empty() ? "0%" : props->x},
+        {DOM_SVG_Y, props->y.empty() ? "0%" : props->y},
+        {DOM_SVG_WIDTH, props->width.empty() ? "100%" : props->width},
+        {DOM_SVG_HEIGHT, props->height.empty() ? "100%" : props->height},
+        {DOM_SVG_FE_IN, props->in1},
+        {DOM_SVG_FE_RESULT, props->result},
+        {DOM_SVG_FE_IN2, props->in2},
+        {DOM_SVG_FE_MODE, props->mode},
+    };
+    for (const auto &[name, value] : attrs) {
+        svgFe->SetAttr(name, value);
+    }
+    svgFe->MarkDirty();
+}
+
+SvgArkUINode &RNSVGFeBlendComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -0,0 +1,39 @@
+#include "RNSVGFeCompositeComponentInstance.h"
+#include "Props.h"
+#include "properties/SvgDomType.h"
+#include <react/renderer/core/ConcreteState.h>
+
+namespace rnoh {
+
+RNSVGFeCompositeComponentInstance::RNSVGFeCompositeComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgFeComposite>(), getTag());
+}
+
+void RNSVGFeCompositeComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgFe = std::dynamic_pointer_cast<SvgFeComposite>(GetSvgNode());
+    // the subregion defaults to the filter region, in to the previous result
+    const std::pair<const char *, std::string> attrs[] = {
+        {DOM_SVG_X, props->x.empty() ? "0%" : props->x},
+        {DOM_SVG_Y, props->y.empty() ? "0%" : props->y},
+        {DOM_SVG_WIDTH, props->width.empty() ? "100%" : props->width},
+        {DOM_SVG_HEIGHT, props->height.empty() ? "100%" : props->height},
+        {DOM_SVG_FE_IN, props->in1},
+        {DOM_SVG_FE_RESULT, props->result},
+        {DOM_SVG_FE_IN2, props->in2},
+        {DOM_SVG_FE_OPERATOR_TYPE, props->operator1},
+        {DOM_SVG_FE_K1, props->k1.empty() ? "0" : props->k1},
+        {DOM_SVG_FE_K2, props->k2.empty() ? "0" : props->k2},
+        {DOM_SVG_FE_K3, props->k3.empty() ? "0" : props->k3},
+        {DOM_SVG_FE_K4, props->k4.empty() ? "0" : props->k4},
+    };
+    for (const auto &[name, value] : attrs) {
+        svgFe->SetAttr(name, value);
+    }
+    svgFe->MarkDirty();
+}
+
+SvgArkUINode &RNSVGFeCompositeComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
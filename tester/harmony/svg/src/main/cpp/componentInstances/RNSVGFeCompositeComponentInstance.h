@@ -0,0 +1,27 @@
+#pragma once
+#include "RNOH/CppComponentInstance.h"
+#include <folly/dynamic.h>
+#include "SvgArkUINode.h"
+#include "ShadowNodes.h"
+#include "SvgFeComposite.h"
+
+namespace rnoh {
+
+// Filter primitive, run by the SvgFilter it is a child of.
+class RNSVGFeCompositeComponentInstance : public CppComponentInstance<facebook::react::RNSVGFeCompositeShadowNode>,
+                                          public SvgHost {
+private:
+    SvgArkUINode m_svgArkUINode;
+
+public:
+    RNSVGFeCompositeComponentInstance(Context context);
+
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override {}
+
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override {}
+
+    SvgArkUINode &getLocalRootArkUINode() override;
+
+    void onPropsChanged(SharedConcreteProps const &props) override;
+};
+} // namespace rnoh
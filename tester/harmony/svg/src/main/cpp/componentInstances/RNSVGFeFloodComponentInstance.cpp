@@ -0,0 +1,35 @@
+#include "RNSVGFeFloodComponentInstance.h"
+#include "Props.h"
+#include "properties/SvgDomType.h"
+#include <react/renderer/core/ConcreteState.h>
+
+namespace rnoh {
+
+RNSVGFeFloodComponentInstance::RNSVGFeFloodComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgFeFlood>(), getTag());
+}
+
+void RNSVGFeFloodComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgFe = std::dynamic_pointer_cast<SvgFeFlood>(GetSvgNode());
+    // the subregion defaults to the filter region, in to the previous result
+    const std::pair<const char *, std::string> attrs[] = {
+        {DOM_SVG_X, props->x.empty() ? "0%" : props->x},
+        {DOM_SVG_Y, props->y.empty() ? "0%" : props->y},
+        {DOM_SVG_WIDTH, props->width.empty() ? "100%" : props->width},
+        {DOM_SVG_HEIGHT, props->height.empty() ? "100%" : props->height},
+        {DOM_SVG_FE_IN, props->in1},
+        {DOM_SVG_FE_RESULT, props->result},
+        {DOM_SVG_FE_FLOOD_COLOR, props->floodColor.empty() ? "black" : props->floodColor},
+        {DOM_SVG_FE_FLOOD_OPACITY, props->floodOpacity.empty() ? "1" : props->floodOpacity},
+    };
+    for (const auto &[name, value] : attrs) {
+        svgFe->SetAttr(name, value);
+    }
+    svgFe->MarkDirty();
+}
+
+SvgArkUINode &RNSVGFeFloodComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -0,0 +1,34 @@
+#include "RNSVGFilterComponentInstance.h"
+#include "Props.h"
+#include "properties/SvgDomType.h"
+#include <react/renderer/core/ConcreteState.h>
+
+namespace rnoh {
+
+RNSVGFilterComponentInstance::RNSVGFilterComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgFilter>(), getTag());
+}
+
+void RNSVGFilterComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgFilter = std::dynamic_pointer_cast<SvgFilter>(GetSvgNode());
+    svgFilter->SetId(props->name);
+    // absent values fall back to the defaults of the SVG spec
+    const std::pair<const char *, std::string> attrs[] = {
+        {DOM_SVG_X, props->x.empty() ? "-10%" : props->x},
+        {DOM_SVG_Y, props->y.empty() ? "-10%" : props->y},
+        {DOM_SVG_WIDTH, props->width.empty() ? "120%" : props->width},
+        {DOM_SVG_HEIGHT, props->height.empty() ? "120%" : props->height},
+        {DOM_SVG_FILTER_UNITS, props->filterUnits.empty() ? "objectBoundingBox" : props->filterUnits},
+        {DOM_SVG_PRIMITIVE_UNITS, props->primitiveUnits.empty() ? "userSpaceOnUse" : props->primitiveUnits},
+    };
+    for (const auto &[name, value] : attrs) {
+        svgFilter->SetAttr(name, value);
+    }
+    svgFilter->MarkDirty();
+}
+
+SvgArkUINode &RNSVGFilterComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -0,0 +1,31 @@
+#pragma once
+#include "RNOH/CppComponentInstance.h"
+#include <folly/dynamic.h>
+#include "SvgArkUINode.h"
+#include "ShadowNodes.h"
+#include "SvgFilter.h"
+
+namespace rnoh {
+
+// <filter>, its children are the primitives run on the filtered element.
+class RNSVGFilterComponentInstance : public CppComponentInstance<facebook::react::RNSVGFilterShadowNode>,
+                                     public SvgHost {
+private:
+    SvgArkUINode m_svgArkUINode;
+
+public:
+    RNSVGFilterComponentInstance(Context context);
+
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override {
+        OnChildInsertCommon(childComponentInstance, index);
+    }
+
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override {
+        OnChildRemoveCommon(childComponentInstance);
+    }
+
+    SvgArkUINode &getLocalRootArkUINode() override;
+
+    void onPropsChanged(SharedConcreteProps const &props) override;
+};
+} // namespace rnoh
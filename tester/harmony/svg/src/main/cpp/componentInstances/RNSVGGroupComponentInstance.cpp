@@ -6,13 +6,20 @@
 namespace rnoh {
 
 RNSVGGroupComponentInstance::RNSVGGroupComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgGroup>());
+    SetSvgNode(std::make_shared<SvgGroup>(), getTag());
 }
 
 void RNSVGGroupComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
     CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[RNSVGGroupComponentInstance] props->fill.payload: " << (uint32_t)*props->fill.payload;
-    
+    auto svgGroup = GetSvgNode();
+    svgGroup->SetId(props->name);
+    svgGroup->SetClipPathRef(props->clipPath);
+    svgGroup->SetMaskRef(props->mask);
+    svgGroup->SetFilterRef(props->filter);
+    svgGroup->SetTransform(props->matrix);
+    svgGroup->MarkDirty();
 }
 
 SvgArkUINode &RNSVGGroupComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -16,11 +16,11 @@ public:
     RNSVGGroupComponentInstance(Context context);
     
     void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
-        OnChildInsertCommon(std::dynamic_pointer_cast<SvgHost>(childComponentInstance));
+        OnChildInsertCommon(childComponentInstance, index);
     }
     
     void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
-        
+        OnChildRemoveCommon(childComponentInstance);
     }
     
     SvgArkUINode &getLocalRootArkUINode() override;
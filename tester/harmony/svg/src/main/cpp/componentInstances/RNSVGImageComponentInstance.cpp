@@ -1,17 +1,31 @@
 #include "RNSVGImageComponentInstance.h"
 #include "Props.h"
+#include "utils/StringUtils.h"
 #include <react/renderer/core/ConcreteState.h>
 #include <sstream>
 
 namespace rnoh {
 
 RNSVGImageComponentInstance::RNSVGImageComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgImage>(), getTag());
 }
 
 void RNSVGImageComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
-
+    auto lock = LockTree();
+    auto svgImage = std::dynamic_pointer_cast<SvgImage>(GetSvgNode());
+    svgImage->SetId(props->name);
+    svgImage->SetClipPathRef(props->clipPath);
+    svgImage->SetMaskRef(props->mask);
+    svgImage->SetTransform(props->matrix);
+    svgImage->attr_.x = StringUtils::StringToDimension(props->x, true);
+    svgImage->attr_.y = StringUtils::StringToDimension(props->y, true);
+    svgImage->attr_.width = StringUtils::StringToDimension(props->width, true);
+    svgImage->attr_.height = StringUtils::StringToDimension(props->height, true);
+    svgImage->SetSource(props->src.uri);
+    svgImage->align_ = props->align;
+    svgImage->meetOrSlice_ = static_cast<MeetOrSlice>(props->meetOrSlice);
+    svgImage->MarkDirty();
 }
 
 SvgArkUINode &RNSVGImageComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -27,10 +27,11 @@
 #include <folly/dynamic.h>
 #include "SvgArkUINode.h"
 #include "ShadowNodes.h"
+#include "SvgImage.h"
 
 namespace rnoh {
 
-class RNSVGImageComponentInstance : public CppComponentInstance<facebook::react::RNSVGCircleShadowNode>, public SvgHost {
+class RNSVGImageComponentInstance : public CppComponentInstance<facebook::react::RNSVGImageShadowNode>, public SvgHost {
 
 private:
     SvgArkUINode m_svgArkUINode;
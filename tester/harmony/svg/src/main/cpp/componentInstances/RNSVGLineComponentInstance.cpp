@@ -6,17 +6,24 @@
 namespace rnoh {
 
 RNSVGLineComponentInstance::RNSVGLineComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgLine>());
+    SetSvgNode(std::make_shared<SvgLine>(), getTag());
 }
 
 void RNSVGLineComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
     CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[RNSVGLineComponentInstance] Props->fill.payload: " << (uint32_t)*props->fill.payload;
     LOG(INFO) << "[RNSVGLineComponentInstance] Props->stroke.payload: " << (uint32_t)*props->stroke.payload;
     LOG(INFO) << "[RNSVGLineComponentInstance] props->strokeLinecap: " << props->strokeLinecap;
     LOG(INFO) << "[RNSVGLineComponentInstance] props->strokeLinejoin: " << props->strokeLinejoin;
 //     LOG(INFO) << "[RNSVGLineComponentInstance] props->strokeDasharray: " << props->strokeDasharray[0];
     auto svgLine = std::dynamic_pointer_cast<SvgLine>(GetSvgNode());
+    svgLine->SetId(props->name);
+    svgLine->SetClipPathRef(props->clipPath);
+    svgLine->SetMaskRef(props->mask);
+    svgLine->SetTransform(props->matrix);
+    svgLine->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgLine->SetMarkerRefs(props->markerStart, props->markerMid, props->markerEnd);
     svgLine->x1 = std::stod(props->x1);
     svgLine->y1 = std::stod(props->y1);
     svgLine->x2 = std::stod(props->x2);
@@ -38,6 +45,7 @@ void RNSVGLineComponentInstance::onPropsChanged(SharedConcreteProps const &props
     //     svgLine->SetAttr("strokeLinecap", std::to_string(props->strokeLinecap));
     //     svgLine->SetAttr("strokeLinejoin", std::to_string(props->strokeLinejoin));
     
+    svgLine->MarkDirty();
 }
 
 SvgArkUINode &RNSVGLineComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -0,0 +1,36 @@
+#include "RNSVGMarkerComponentInstance.h"
+#include "Props.h"
+#include "utils/StringUtils.h"
+#include <react/renderer/core/ConcreteState.h>
+#include <sstream>
+
+namespace rnoh {
+
+RNSVGMarkerComponentInstance::RNSVGMarkerComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgMarker>(), getTag());
+}
+
+void RNSVGMarkerComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgMarker = std::dynamic_pointer_cast<SvgMarker>(GetSvgNode());
+    svgMarker->SetId(props->name);
+    svgMarker->refX_ = StringUtils::StringToDouble(props->refX);
+    svgMarker->refY_ = StringUtils::StringToDouble(props->refY);
+    if (!props->markerWidth.empty()) {
+        svgMarker->markerWidth_ = StringUtils::StringToDouble(props->markerWidth);
+    }
+    if (!props->markerHeight.empty()) {
+        svgMarker->markerHeight_ = StringUtils::StringToDouble(props->markerHeight);
+    }
+    svgMarker->markerUnits_ = props->markerUnits.empty() ? "strokeWidth" : props->markerUnits;
+    svgMarker->orient_ = props->orient;
+    svgMarker->viewBox_ = Rect(props->minX, props->minY, props->vbWidth, props->vbHeight);
+    svgMarker->align_ = props->align;
+    svgMarker->meetOrSlice_ = static_cast<MeetOrSlice>(props->meetOrSlice);
+    svgMarker->MarkDirty();
+}
+
+SvgArkUINode &RNSVGMarkerComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
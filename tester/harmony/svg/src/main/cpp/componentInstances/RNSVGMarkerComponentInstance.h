@@ -0,0 +1,54 @@
+/**
+ * MIT License
+ *
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include "RNOH/CppComponentInstance.h"
+#include <folly/dynamic.h>
+#include "SvgArkUINode.h"
+#include "ShadowNodes.h"
+#include "SvgMarker.h"
+
+namespace rnoh {
+
+class RNSVGMarkerComponentInstance : public CppComponentInstance<facebook::react::RNSVGMarkerShadowNode>, public SvgHost {
+
+private:
+    SvgArkUINode m_svgArkUINode;
+
+public:
+    RNSVGMarkerComponentInstance(Context context);
+    
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
+        OnChildInsertCommon(childComponentInstance, index);
+    }
+    
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
+        OnChildRemoveCommon(childComponentInstance);
+    }
+    
+    SvgArkUINode &getLocalRootArkUINode() override;
+    
+    void onPropsChanged(SharedConcreteProps const &props) override;
+};
+} // namespace rnoh
\ No newline at end of file
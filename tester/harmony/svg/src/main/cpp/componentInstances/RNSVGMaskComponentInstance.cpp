@@ -1,17 +1,29 @@
 #include "RNSVGMaskComponentInstance.h"
 #include "Props.h"
+#include "utils/StringUtils.h"
 #include <react/renderer/core/ConcreteState.h>
 #include <sstream>
 
 namespace rnoh {
 
 RNSVGMaskComponentInstance::RNSVGMaskComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgMask>(), getTag());
 }
 
 void RNSVGMaskComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
-    
+    auto lock = LockTree();
+    auto svgMask = std::dynamic_pointer_cast<SvgMask>(GetSvgNode());
+    svgMask->SetId(props->name);
+    // props follow RNSVGUnits: 0 objectBoundingBox, 1 userSpaceOnUse
+    const bool boundingBoxUnits = props->maskUnits == 0;
+    svgMask->attr_.maskUnits = boundingBoxUnits ? "objectBoundingBox" : "userSpaceOnUse";
+    svgMask->attr_.maskContentUnits = props->maskContentUnits == 0 ? "objectBoundingBox" : "userSpaceOnUse";
+    svgMask->attr_.x = StringUtils::StringToDimension(props->x, !boundingBoxUnits);
+    svgMask->attr_.y = StringUtils::StringToDimension(props->y, !boundingBoxUnits);
+    svgMask->attr_.width = StringUtils::StringToDimension(props->width, !boundingBoxUnits);
+    svgMask->attr_.height = StringUtils::StringToDimension(props->height, !boundingBoxUnits);
+    svgMask->MarkDirty();
 }
 
 SvgArkUINode &RNSVGMaskComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -27,6 +27,7 @@
 #include <folly/dynamic.h>
 #include "SvgArkUINode.h"
 #include "ShadowNodes.h"
+#include "SvgMask.h"
 
 namespace rnoh {
 
@@ -39,10 +40,12 @@ public:
     RNSVGMaskComponentInstance(Context context);
     
     void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
-        OnChildInsertCommon(std::dynamic_pointer_cast<SvgHost>(childComponentInstance));
+        OnChildInsertCommon(childComponentInstance, index);
     }
     
-    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{}
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
+        OnChildRemoveCommon(childComponentInstance);
+    }
     
     SvgArkUINode &getLocalRootArkUINode() override;
     
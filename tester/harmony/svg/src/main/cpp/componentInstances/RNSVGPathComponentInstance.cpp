@@ -6,19 +6,36 @@
 namespace rnoh {
 
 RNSVGPathComponentInstance::RNSVGPathComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgPath>());
+    SetSvgNode(std::make_shared<SvgPath>(), getTag());
 }
 
 void RNSVGPathComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     
     LOG(INFO) << "[RNSVGPathComponentInstance] d: " << props->d;
     LOG(INFO) << "[RNSVGCircleComponentInstance] fill.payload: " << (uint32_t)*props->fill.payload;
     auto svgPath = std::dynamic_pointer_cast<SvgPath>(GetSvgNode());
+    svgPath->SetId(props->name);
+    svgPath->SetClipPathRef(props->clipPath);
+    svgPath->SetMaskRef(props->mask);
+    svgPath->SetTransform(props->matrix);
+    svgPath->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgPath->SetMarkerRefs(props->markerStart, props->markerMid, props->markerEnd);
     // set attribute to svgPath.
     // need to convert color
     svgPath->colorFill = (uint32_t)*props->fill.payload;
-    svgPath->d = props->d;
+    svgPath->SetD(props->d);
+    svgPath->setBrushColor((uint32_t)*props->fill.payload, props->fillOpacity);
+    svgPath->setStrokColor((uint32_t)*props->stroke.payload);
+    svgPath->setStrokeLineWith(props->strokeWidth);
+    svgPath->setStrokeDasharray(props->strokeDasharray);
+    svgPath->setStrokeDashoffset(props->strokeDashoffset);
+    svgPath->setStrokeLineCap(props->strokeLinecap);
+    svgPath->setStrokeLineJoin(props->strokeLinejoin);
+    svgPath->setStrokeMiterlimit(props->strokeMiterlimit);
+    svgPath->setStrokeOpacity(props->strokeOpacity);
+    svgPath->MarkDirty();
 }
 
 
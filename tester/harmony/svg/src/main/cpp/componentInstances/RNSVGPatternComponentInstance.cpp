@@ -0,0 +1,35 @@
+#include "RNSVGPatternComponentInstance.h"
+#include "Props.h"
+#include "utils/StringUtils.h"
+#include <react/renderer/core/ConcreteState.h>
+#include <sstream>
+
+namespace rnoh {
+
+RNSVGPatternComponentInstance::RNSVGPatternComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgPattern>(), getTag());
+}
+
+void RNSVGPatternComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgPattern = std::dynamic_pointer_cast<SvgPattern>(GetSvgNode());
+    svgPattern->SetId(props->name);
+    // props follow RNSVGUnits: 0 objectBoundingBox, 1 userSpaceOnUse
+    const bool boundingBoxUnits = props->patternUnits == 0;
+    svgPattern->attr_.patternUnits = boundingBoxUnits ? "objectBoundingBox" : "userSpaceOnUse";
+    svgPattern->attr_.patternContentUnits = props->patternContentUnits == 0 ? "objectBoundingBox" : "userSpaceOnUse";
+    svgPattern->attr_.x = StringUtils::StringToDimension(props->x, !boundingBoxUnits);
+    svgPattern->attr_.y = StringUtils::StringToDimension(props->y, !boundingBoxUnits);
+    svgPattern->attr_.width = StringUtils::StringToDimension(props->width, !boundingBoxUnits);
+    svgPattern->attr_.height = StringUtils::StringToDimension(props->height, !boundingBoxUnits);
+    svgPattern->attr_.viewBox = Rect(props->minX, props->minY, props->vbWidth, props->vbHeight);
+    svgPattern->align_ = props->align;
+    svgPattern->meetOrSlice_ = static_cast<MeetOrSlice>(props->meetOrSlice);
+    svgPattern->patternMatrix_.assign(props->patternTransform.begin(), props->patternTransform.end());
+    svgPattern->MarkDirty();
+}
+
+SvgArkUINode &RNSVGPatternComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
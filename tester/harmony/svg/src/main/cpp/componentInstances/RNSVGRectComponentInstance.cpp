@@ -6,17 +6,23 @@
 namespace rnoh {
 
 RNSVGRectComponentInstance::RNSVGRectComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgRect>());
+    SetSvgNode(std::make_shared<SvgRect>(), getTag());
 }
 
 void RNSVGRectComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[RNSVGRectComponentInstance] Props->fill.payload: " << (uint32_t)*props->fill.payload;
     LOG(INFO) << "[RNSVGRectComponentInstance] Props->stroke.payload: " << (uint32_t)*props->stroke.payload;
     LOG(INFO) << "[RNSVGRectComponentInstance] Props->strokeWidth: " << props->strokeWidth;
     LOG(INFO) << "[RNSVGRectComponentInstance] Props->rx: " << props->rx;
     LOG(INFO) << "[RNSVGRectComponentInstance] Props->ry: " << props->ry;
     auto svgRect = std::dynamic_pointer_cast<SvgRect>(GetSvgNode());
+    svgRect->SetId(props->name);
+    svgRect->SetClipPathRef(props->clipPath);
+    svgRect->SetMaskRef(props->mask);
+    svgRect->SetTransform(props->matrix);
+    svgRect->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
     svgRect->x = std::stod(props->x);
     svgRect->y = std::stod(props->y);
     svgRect->width = std::stod(props->width);
@@ -38,6 +44,7 @@ void RNSVGRectComponentInstance::onPropsChanged(SharedConcreteProps const &props
     svgRect->setStrokeLineJoin(props->strokeLinejoin);
     svgRect->setStrokeMiterlimit(props->strokeMiterlimit);
     svgRect->setStrokeOpacity(props->strokeOpacity);
+    svgRect->MarkDirty();
 }
 
 SvgArkUINode &RNSVGRectComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -3,18 +3,22 @@
 #include <react/renderer/core/ConcreteState.h>
 #include <sstream>
 #include "SvgSvg.h"
+#include "SvgNativeProps.h"
 
 namespace rnoh {
 
 RNSVGSvgViewComponentInstance::RNSVGSvgViewComponentInstance(Context context)
     : CppComponentInstance(std::move(context)) {
-    SetSvgNode(std::make_shared<SvgSvg>());
+    auto context = std::make_shared<SvgContext>();
+    SetSvgNode(std::make_shared<SvgSvg>(), getTag());
     m_svgArkUINode.SetSvgNode(GetSvgNode());
-    GetSvgNode()->SetContext(std::make_shared<SvgContext>());
+    GetSvgNode()->SetContext(context);
+    SvgSvg::RegisterDocument(getTag(), std::static_pointer_cast<SvgSvg>(GetSvgNode()));
 }
 
 void RNSVGSvgViewComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
     CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
     LOG(INFO) << "[SVG] <SVGViewComponentInstance> props->width: " << m_layoutMetrics.frame.size.width;
     LOG(INFO) << "[SVG] <SVGViewComponentInstance> props->height: " << m_layoutMetrics.frame.size.height;
     LOG(INFO) << "[SVG] <SVGViewComponentInstance> props->bbHeight: " << props->bbHeight;
@@ -33,10 +37,63 @@ void RNSVGSvgViewComponentInstance::onPropsChanged(SharedConcreteProps const &pr
     svg->attr_.y = Dimension(props->minY);
     svg->attr_.width = Dimension(props->vbWidth);
     svg->attr_.height = Dimension(props->vbHeight);
+    svg->UpdateViewBox();
+    svg->align_ = props->align;
+    svg->meetOrSlice_ = static_cast<MeetOrSlice>(props->meetOrSlice);
+    // "static" documents are drawn from a cached raster
+    svg->SetRasterCache(props->renderMode == "static");
+    svg->SetTintColor(props->tintColor ? (uint32_t)*props->tintColor : 0);
 
     svg->InitStyle({});
 }
 
+void RNSVGSvgViewComponentInstance::handleCommand(std::string const &commandName, folly::dynamic const &args) {
+    if (commandName != "setNativeProps" || !args.isArray()) {
+        CppComponentInstance::handleCommand(commandName, args);
+        return;
+    }
+    std::vector<SvgNativeProp> props;
+    props.reserve(args.size());
+    for (const auto &update : args) {
+        if (!update.isArray() || update.size() < 3 || !update[0].isNumber() || !update[1].isString()) {
+            continue;
+        }
+        SvgNativeProp prop;
+        prop.tag = static_cast<int32_t>(update[0].asInt());
+        prop.name = update[1].getString();
+        const auto &value = update[2];
+        if (value.isNumber()) {
+            prop.numbers.push_back(value.asDouble());
+        } else if (value.isString()) {
+            prop.text = value.getString();
+        } else if (value.isArray()) {
+            // asDouble() throws on anything else; drop the whole update instead
+            bool numeric = true;
+            for (const auto &number : value) {
+                if (!number.isNumber()) {
+                    numeric = false;
+                    break;
+                }
+                prop.numbers.push_back(number.asDouble());
+            }
+            if (!numeric) {
+                continue;
+            }
+        } else {
+            continue;
+        }
+        props.emplace_back(std::move(prop));
+    }
+    bool changed;
+    {
+        auto lock = LockTree();
+        changed = ApplyNativeProps(*GetSvgNode()->GetContext(), props);
+    }
+    if (changed) {
+        m_svgArkUINode.RequestRender();
+    }
+}
+
 SvgArkUINode &RNSVGSvgViewComponentInstance::getLocalRootArkUINode() {
     return m_svgArkUINode;
 }
@@ -16,14 +16,19 @@ public:
 
     // get SvgNode from childComponentInstance and set it to root_
     void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override {
-        OnChildInsertCommon(std::dynamic_pointer_cast<SvgHost>(childComponentInstance));
+        OnChildInsertCommon(childComponentInstance, index);
     }
     
-    // TODO get SvgNode and delete it from svg tree
-    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override {}
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override {
+        OnChildRemoveCommon(childComponentInstance);
+    }
     
     SvgArkUINode &getLocalRootArkUINode() override;
     
     void onPropsChanged(SharedConcreteProps const &props) override;
+
+    // "setNativeProps" with [[tag, name, value], ...]: writes animated values
+    // into the document's nodes without a React commit, redrawing once.
+    void handleCommand(std::string const &commandName, folly::dynamic const &args) override;
 };
 } // namespace rnoh
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "RNSVGSymbolComponentInstance.h"
+#include "Props.h"
+#include <react/renderer/core/ConcreteState.h>
+#include <sstream>
+
+namespace rnoh {
+
+RNSVGSymbolComponentInstance::RNSVGSymbolComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgSymbol>(), getTag());
+}
+
+void RNSVGSymbolComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgSymbol = std::dynamic_pointer_cast<SvgSymbol>(GetSvgNode());
+    svgSymbol->SetId(props->name);
+    svgSymbol->viewBox_ = Rect(props->minX, props->minY, props->vbWidth, props->vbHeight);
+    svgSymbol->align_ = props->align;
+    svgSymbol->meetOrSlice_ = static_cast<MeetOrSlice>(props->meetOrSlice);
+    svgSymbol->MarkDirty();
+}
+
+SvgArkUINode &RNSVGSymbolComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -6,11 +6,31 @@
 namespace rnoh {
 
 RNSVGTSpanComponentInstance::RNSVGTSpanComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgTSpan>(), getTag());
 }
 
 void RNSVGTSpanComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgTSpan = std::dynamic_pointer_cast<SvgTSpan>(GetSvgNode());
+    svgTSpan->SetId(props->name);
+    svgTSpan->SetClipPathRef(props->clipPath);
+    svgTSpan->SetMaskRef(props->mask);
+    svgTSpan->SetTransform(props->matrix);
+    svgTSpan->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgTSpan->setBrushColor((uint32_t)*props->fill.payload, props->fillOpacity);
+    svgTSpan->setStrokColor((uint32_t)*props->stroke.payload);
+    svgTSpan->setStrokeLineWith(props->strokeWidth);
+    svgTSpan->setStrokeDasharray(props->strokeDasharray);
+    svgTSpan->setStrokeDashoffset(props->strokeDashoffset);
+    svgTSpan->setStrokeLineCap(props->strokeLinecap);
+    svgTSpan->setStrokeLineJoin(props->strokeLinejoin);
+    svgTSpan->setStrokeMiterlimit(props->strokeMiterlimit);
+    svgTSpan->setStrokeOpacity(props->strokeOpacity);
+    // font, content and positions re-layout only when they changed
+    svgTSpan->SetTextProps(*props);
+    svgTSpan->SetContent(props->content);
+    svgTSpan->MarkDirty();
 }
 
 SvgArkUINode &RNSVGTSpanComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -27,6 +27,7 @@
 #include <folly/dynamic.h>
 #include "SvgArkUINode.h"
 #include "ShadowNodes.h"
+#include "SvgTSpan.h"
 
 namespace rnoh {
 
@@ -39,9 +40,13 @@ public:
 
     RNSVGTSpanComponentInstance(Context context);
     
-    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{}
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
+        OnChildInsertCommon(childComponentInstance, index);
+    }
     
-    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{}
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
+        OnChildRemoveCommon(childComponentInstance);
+    }
     
     SvgArkUINode &getLocalRootArkUINode() override;
     
@@ -6,11 +6,30 @@
 namespace rnoh {
 
 RNSVGTextComponentInstance::RNSVGTextComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgText>(), getTag());
 }
 
 void RNSVGTextComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
      CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgText = std::dynamic_pointer_cast<SvgText>(GetSvgNode());
+    svgText->SetId(props->name);
+    svgText->SetClipPathRef(props->clipPath);
+    svgText->SetMaskRef(props->mask);
+    svgText->SetTransform(props->matrix);
+    svgText->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgText->setBrushColor((uint32_t)*props->fill.payload, props->fillOpacity);
+    svgText->setStrokColor((uint32_t)*props->stroke.payload);
+    svgText->setStrokeLineWith(props->strokeWidth);
+    svgText->setStrokeDasharray(props->strokeDasharray);
+    svgText->setStrokeDashoffset(props->strokeDashoffset);
+    svgText->setStrokeLineCap(props->strokeLinecap);
+    svgText->setStrokeLineJoin(props->strokeLinejoin);
+    svgText->setStrokeMiterlimit(props->strokeMiterlimit);
+    svgText->setStrokeOpacity(props->strokeOpacity);
+    // font, content and positions re-layout only when they changed
+    svgText->SetTextProps(*props);
+    svgText->MarkDirty();
 }
 
 
@@ -27,6 +27,7 @@
 #include <folly/dynamic.h>
 #include "SvgArkUINode.h"
 #include "ShadowNodes.h"
+#include "SvgText.h"
 
 namespace rnoh {
 
@@ -38,9 +39,13 @@ private:
 public:
     RNSVGTextComponentInstance(Context context);
     
-    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{}
+    void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
+        OnChildInsertCommon(childComponentInstance, index);
+    }
     
-    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{}
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
+        OnChildRemoveCommon(childComponentInstance);
+    }
     
     SvgArkUINode &getLocalRootArkUINode() override;
     
@@ -0,0 +1,39 @@
+#include "RNSVGTextPathComponentInstance.h"
+#include "Props.h"
+#include <react/renderer/core/ConcreteState.h>
+#include <sstream>
+
+namespace rnoh {
+
+RNSVGTextPathComponentInstance::RNSVGTextPathComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
+    SetSvgNode(std::make_shared<SvgTextPath>(), getTag());
+}
+
+void RNSVGTextPathComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
+     CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgTextPath = std::dynamic_pointer_cast<SvgTextPath>(GetSvgNode());
+    svgTextPath->SetId(props->name);
+    svgTextPath->SetClipPathRef(props->clipPath);
+    svgTextPath->SetMaskRef(props->mask);
+    svgTextPath->SetTransform(props->matrix);
+    svgTextPath->SetFillRef(props->fill.type == 1 ? props->fill.brushRef : "");
+    svgTextPath->setBrushColor((uint32_t)*props->fill.payload, props->fillOpacity);
+    svgTextPath->setStrokColor((uint32_t)*props->stroke.payload);
+    svgTextPath->setStrokeLineWith(props->strokeWidth);
+    svgTextPath->setStrokeDasharray(props->strokeDasharray);
+    svgTextPath->setStrokeDashoffset(props->strokeDashoffset);
+    svgTextPath->setStrokeLineCap(props->strokeLinecap);
+    svgTextPath->setStrokeLineJoin(props->strokeLinejoin);
+    svgTextPath->setStrokeMiterlimit(props->strokeMiterlimit);
+    svgTextPath->setStrokeOpacity(props->strokeOpacity);
+    // font and positions re-layout only when they changed
+    svgTextPath->SetTextProps(*props);
+    svgTextPath->SetPathRef(props->href);
+    svgTextPath->SetPlacement(props->startOffset, props->side, props->method, props->spacing);
+    svgTextPath->MarkDirty();
+}
+
+SvgArkUINode &RNSVGTextPathComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
+
+} // namespace rnoh
@@ -1,16 +1,29 @@
 #include "RNSVGUseComponentInstance.h"
 #include "Props.h"
+#include "utils/StringUtils.h"
 #include <react/renderer/core/ConcreteState.h>
 #include <sstream>
 
 namespace rnoh {
 
 RNSVGUseComponentInstance::RNSVGUseComponentInstance(Context context) : CppComponentInstance(std::move(context)) {
-//     SetSvgNode(std::make_shared<SvgCircle>());
+    SetSvgNode(std::make_shared<SvgUse>(), getTag());
 }
 
 void RNSVGUseComponentInstance::onPropsChanged(SharedConcreteProps const &props) {
-     CppComponentInstance::onPropsChanged(props);
+    CppComponentInstance::onPropsChanged(props);
+    auto lock = LockTree();
+    auto svgUse = std::dynamic_pointer_cast<SvgUse>(GetSvgNode());
+    svgUse->SetId(props->name);
+    svgUse->SetClipPathRef(props->clipPath);
+    svgUse->SetMaskRef(props->mask);
+    svgUse->SetTransform(props->matrix);
+    svgUse->SetHref(props->href);
+    svgUse->x_ = StringUtils::StringToDouble(props->x);
+    svgUse->y_ = StringUtils::StringToDouble(props->y);
+    svgUse->width_ = StringUtils::StringToDouble(props->width);
+    svgUse->height_ = StringUtils::StringToDouble(props->height);
+    svgUse->MarkDirty();
 }
 
 SvgArkUINode &RNSVGUseComponentInstance::getLocalRootArkUINode() { return m_svgArkUINode; }
@@ -28,6 +28,7 @@
 #include <math.h>
 #include "SvgArkUINode.h"
 #include "ShadowNodes.h"
+#include "SvgUse.h"
 
 namespace rnoh {
 
@@ -40,10 +41,12 @@ public:
     RNSVGUseComponentInstance(Context context);
     
     void onChildInserted(ComponentInstance::Shared const &childComponentInstance, std::size_t index) override{
-        OnChildInsertCommon(std::dynamic_pointer_cast<SvgHost>(childComponentInstance));
+        OnChildInsertCommon(childComponentInstance, index);
     }
     
-    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{}
+    void onChildRemoved(ComponentInstance::Shared const &childComponentInstance) override{
+        OnChildRemoveCommon(childComponentInstance);
+    }
     
     SvgArkUINode &getLocalRootArkUINode() override;
     
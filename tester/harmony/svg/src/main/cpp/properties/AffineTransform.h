@@ -0,0 +1,109 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include "properties/Rect.h"
+
+namespace rnoh {
+
+// 2x3 affine matrix, maps (x, y) to (a * x + c * y + e, b * x + d * y + f),
+// the layout of SVG's matrix(a b c d e f).
+struct AffineTransform {
+    double a = 1.0;
+    double b = 0.0;
+    double c = 0.0;
+    double d = 1.0;
+    double e = 0.0;
+    double f = 0.0;
+
+    static AffineTransform Translate(double tx, double ty)
+    {
+        return {1.0, 0.0, 0.0, 1.0, tx, ty};
+    }
+
+    static AffineTransform Scale(double sx, double sy)
+    {
+        return {sx, 0.0, 0.0, sy, 0.0, 0.0};
+    }
+
+    static AffineTransform Rotate(double degrees)
+    {
+        const double radians = degrees * M_PI / 180.0;
+        const double cos = std::cos(radians);
+        const double sin = std::sin(radians);
+        return {cos, sin, -sin, cos, 0.0, 0.0};
+    }
+
+    static AffineTransform Skew(double xDegrees, double yDegrees)
+    {
+        return {1.0, std::tan(yDegrees * M_PI / 180.0), std::tan(xDegrees * M_PI / 180.0), 1.0, 0.0, 0.0};
+    }
+
+    bool IsIdentity() const
+    {
+        return IsTranslateOnly() && e == 0.0 && f == 0.0;
+    }
+
+    bool IsTranslateOnly() const
+    {
+        return a == 1.0 && b == 0.0 && c == 0.0 && d == 1.0;
+    }
+
+    // this * other: other is applied first
+    AffineTransform operator*(const AffineTransform& other) const
+    {
+        return {a * other.a + c * other.b,
+                b * other.a + d * other.b,
+                a * other.c + c * other.d,
+                b * other.c + d * other.d,
+                a * other.e + c * other.f + e,
+                b * other.e + d * other.f + f};
+    }
+
+    AffineTransform& operator*=(const AffineTransform& other)
+    {
+        return *this = *this * other;
+    }
+
+    bool operator==(const AffineTransform& other) const
+    {
+        return a == other.a && b == other.b && c == other.c && d == other.d && e == other.e && f == other.f;
+    }
+
+    bool operator!=(const AffineTransform& other) const
+    {
+        return !operator==(other);
+    }
+
+    // bounding box of r after the transform
+    Rect MapRect(const Rect& r) const
+    {
+        if (IsTranslateOnly()) {
+            return Rect(r.Left() + e, r.Top() + f, r.Width(), r.Height());
+        }
+        const double xs[] = {r.Left(), r.Right()};
+        const double ys[] = {r.Top(), r.Bottom()};
+        double left = INFINITY;
+        double top = INFINITY;
+        double right = -INFINITY;
+        double bottom = -INFINITY;
+        for (double x : xs) {
+            for (double y : ys) {
+                const double mappedX = a * x + c * y + e;
+                const double mappedY = b * x + d * y + f;
+                left = std::min(left, mappedX);
+                right = std::max(right, mappedX);
+                top = std::min(top, mappedY);
+                bottom = std::max(bottom, mappedY);
+            }
+        }
+        return Rect(left, top, right - left, bottom - top);
+    }
+
+    // largest length a unit vector can be scaled to, for raster resolution
+    double GetMaxScale() const
+    {
+        return std::max(std::hypot(a, b), std::hypot(c, d));
+    }
+};
+
+} // namespace rnoh
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <cstdint>
 #include <regex>
 #include "Color.h"
@@ -27,6 +28,33 @@ constexpr uint8_t MAX_RGB_VALUE = 255;
 constexpr double MIN_RGBA_OPACITY = 0.0;
 constexpr double MAX_RGBA_OPACITY = 1.0;
 
+// pow(i, GAMMA_FACTOR) for every byte i
+const std::array<double, 256>& GetGammaToLinearTable()
+{
+    static const auto table = [] {
+        std::array<double, 256> values{};
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = std::pow(static_cast<double>(i), GAMMA_FACTOR);
+        }
+        return values;
+    }();
+    return table;
+}
+
+// pow(i + 0.5, GAMMA_FACTOR): a linear value rounds to the byte of the first
+// bound above it, which is exactly round(pow(value, 1 / GAMMA_FACTOR))
+const std::array<double, 255>& GetLinearToGammaBounds()
+{
+    static const auto table = [] {
+        std::array<double, 255> values{};
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = std::pow(i + 0.5, GAMMA_FACTOR);
+        }
+        return values;
+    }();
+    return table;
+}
+
 } // namespace
 
 const Color Color::TRANSPARENT = Color(0x00000000);
@@ -273,12 +301,13 @@ Color Color::operator/(double value) const
 
 double Color::ConvertGammaToLinear(uint8_t value)
 {
-    return std::pow(value, GAMMA_FACTOR);
+    return GetGammaToLinearTable()[value];
 }
 
 uint8_t Color::ConvertLinearToGamma(double value)
 {
-    return std::clamp(static_cast<int32_t>(round(std::pow(value, 1.0 / GAMMA_FACTOR))), 0, UINT8_MAX);
+    const auto& bounds = GetLinearToGammaBounds();
+    return static_cast<uint8_t>(std::upper_bound(bounds.begin(), bounds.end(), value) - bounds.begin());
 }
 
 void Color::ConvertGammaToLinear(const Color& gammaColor, double& linearRed, double& linearGreen, double& linearBlue)
@@ -27,6 +27,12 @@ const char DOM_SVG_ANIMATION_KEY_POINTS[] = "keypoints";
 const char DOM_SVG_ANIMATION_PATH[] = "path";
 const char DOM_SVG_ANIMATION_ROTATE[] = "rotate";
 const char DOM_SVG_ATTR_PATH[] = "path";
+// attribute names as SVG spells them, e.g. in attributeName
+const char DOM_SVG_SRC_FILL_OPACITY[] = "fill-opacity";
+const char DOM_SVG_SRC_STROKE_DASHOFFSET[] = "stroke-dashoffset";
+const char DOM_SVG_SRC_STROKE_OPACITY[] = "stroke-opacity";
+const char DOM_SVG_SRC_STROKE_WIDTH[] = "stroke-width";
+const char DOM_SVG_SRC_TRANSFORM[] = "transform";
 const char DOM_SVG_START_OFFSET[] = "startoffset";
 const char DOM_SVG_FILL[] = "fill";
 const char DOM_SVG_FILL_OPACITY[] = "fillOpacity";
@@ -74,6 +80,8 @@ const char DOM_SVG_MASK_CONTENT_UNITS[] = "maskcontentunits";
 const char DOM_SVG_MASK_UNITS[] = "maskunits";
 const char DOM_SVG_PATTERN_CONTENT_UNITS[] = "patterncontentunits";
 const char DOM_SVG_PATTERN_UNITS[] = "patternunits";
+const char DOM_SVG_FILTER_UNITS[] = "filterunits";
+const char DOM_SVG_PRIMITIVE_UNITS[] = "primitiveunits";
 const char DOM_SVG_PATTERN_TRANSFORM[] = "patterntransform";
 const char DOM_SVG_OFFSET[] = "offset";
 const char DOM_SVG_STOP_COLOR[] = "stopColor";
@@ -1,15 +1,146 @@
-
 #include "RNSVGSvgViewModule.h"
-
-// This file was generated.
+#include "SvgSnapshot.h"
+#include "SvgThumbnailBatch.h"
+#include "utils/WorkerPool.h"
 
 namespace rnoh {
 using namespace facebook;
 
+namespace {
+float GetNumber(jsi::Runtime &rt, const jsi::Object &options, const char *name, float fallback) {
+    auto value = options.getProperty(rt, name);
+    return value.isNumber() ? static_cast<float>(value.asNumber()) : fallback;
+}
+
+SnapshotOptions ParseSnapshotOptions(jsi::Runtime &rt, const jsi::Value &value) {
+    SnapshotOptions options;
+    if (!value.isObject()) {
+        return options;
+    }
+    auto object = value.asObject(rt);
+    options.width = GetNumber(rt, object, "width", 0.0f);
+    options.height = GetNumber(rt, object, "height", 0.0f);
+    options.scale = GetNumber(rt, object, "scale", 1.0f);
+    options.quality = GetNumber(rt, object, "quality", static_cast<float>(options.quality));
+    auto format = object.getProperty(rt, "format");
+    if (format.isString()) {
+        const auto name = format.asString(rt).utf8(rt);
+        options.format = name == "jpeg" || name == "jpg" ? SnapshotFormat::JPEG : SnapshotFormat::PNG;
+    }
+    return options;
+}
+
+bool IsFunction(jsi::Runtime &rt, const jsi::Value &value) {
+    return value.isObject() && value.asObject(rt).isFunction(rt);
+}
+} // namespace
+
 RNSVGSvgViewModule::RNSVGSvgViewModule(const ArkTSTurboModule::Context ctx, const std::string name) : ArkTSTurboModule(ctx, name) {
     methodMap_ = {
-        ARK_METHOD_METADATA(toDataURL, 3),
+        {"toDataURL",
+         {3, [](jsi::Runtime &rt, react::TurboModule &turboModule, const jsi::Value *args, size_t count) {
+              return static_cast<RNSVGSvgViewModule &>(turboModule).toDataURL(rt, args, count);
+          }}},
+        {"toDataURLBatch",
+         {4, [](jsi::Runtime &rt, react::TurboModule &turboModule, const jsi::Value *args, size_t count) {
+              return static_cast<RNSVGSvgViewModule &>(turboModule).toDataURLBatch(rt, args, count);
+          }}},
+        {"getPrepareTimings",
+         {1, [](jsi::Runtime &rt, react::TurboModule &turboModule, const jsi::Value *args, size_t count) {
+              return static_cast<RNSVGSvgViewModule &>(turboModule).getPrepareTimings(rt, args, count);
+          }}},
     };
 }
 
+jsi::Value RNSVGSvgViewModule::toDataURL(jsi::Runtime &rt, const jsi::Value *args, size_t count) {
+    if (count < 3 || !args[0].isNumber() || !IsFunction(rt, args[2])) {
+        return jsi::Value::undefined();
+    }
+    const auto tag = static_cast<int32_t>(args[0].asNumber());
+    const auto options = ParseSnapshotOptions(rt, args[1]);
+    auto callback = std::make_shared<jsi::Function>(args[2].asObject(rt).asFunction(rt));
+    auto svg = SvgSvg::FindDocument(tag);
+    if (!svg) {
+        callback->call(rt, jsi::String::createFromAscii(rt, ""));
+        return jsi::Value::undefined();
+    }
+    auto jsInvoker = jsInvoker_;
+    WorkerPool::GetInstance().Post([svg, options, callback, jsInvoker, &rt]() mutable {
+        auto base64 = std::make_shared<std::string>(SnapshotToBase64(*svg, options));
+        // the function is released on the JS thread along with the call
+        jsInvoker->invokeAsync([callback = std::move(callback), base64, &rt] {
+            callback->call(rt, jsi::String::createFromAscii(rt, base64->data(), base64->size()));
+        });
+    });
+    return jsi::Value::undefined();
+}
+
+jsi::Value RNSVGSvgViewModule::toDataURLBatch(jsi::Runtime &rt, const jsi::Value *args, size_t count) {
+    if (count < 4 || !args[0].isObject() || !args[0].asObject(rt).isArray(rt) || !IsFunction(rt, args[2]) ||
+        !IsFunction(rt, args[3])) {
+        return jsi::Value::undefined();
+    }
+    auto items = args[0].asObject(rt).asArray(rt);
+    std::vector<ThumbnailRequest> requests(items.size(rt));
+    for (size_t i = 0; i < requests.size(); ++i) {
+        auto item = items.getValueAtIndex(rt, i);
+        if (!item.isObject()) {
+            continue;
+        }
+        auto object = item.asObject(rt);
+        requests[i].tag = static_cast<int32_t>(GetNumber(rt, object, "tag", 0.0f));
+        requests[i].priority = static_cast<int32_t>(GetNumber(rt, object, "priority", 0.0f));
+        requests[i].options = ParseSnapshotOptions(rt, item);
+    }
+    ThumbnailBatchLimits limits;
+    if (args[1].isObject()) {
+        auto object = args[1].asObject(rt);
+        limits.maxConcurrent = static_cast<size_t>(GetNumber(rt, object, "maxConcurrent", 0.0f));
+        limits.memoryBudget =
+            static_cast<size_t>(GetNumber(rt, object, "memoryBudget", static_cast<float>(limits.memoryBudget)));
+    }
+    auto onResult = std::make_shared<jsi::Function>(args[2].asObject(rt).asFunction(rt));
+    auto onDone = std::make_shared<jsi::Function>(args[3].asObject(rt).asFunction(rt));
+    auto jsInvoker = jsInvoker_;
+    // every copy of the functions ends up on the JS thread: the batch drops
+    // onResult before it calls onDone, which hands over the last ones
+    ThumbnailBatch::Start(
+        std::move(requests), limits,
+        [onResult, jsInvoker, &rt](size_t index, std::string base64) {
+            jsInvoker->invokeAsync([onResult, index, base64 = std::move(base64), &rt] {
+                onResult->call(rt, static_cast<double>(index),
+                               jsi::String::createFromAscii(rt, base64.data(), base64.size()));
+            });
+        },
+        [onResult, onDone, jsInvoker, &rt]() mutable {
+            jsInvoker->invokeAsync(
+                [onResult = std::move(onResult), onDone = std::move(onDone), &rt] { onDone->call(rt); });
+        });
+    return jsi::Value::undefined();
+}
+
+jsi::Value RNSVGSvgViewModule::getPrepareTimings(jsi::Runtime &rt, const jsi::Value *args, size_t count) {
+    if (count < 1 || !args[0].isNumber()) {
+        return jsi::Value::null();
+    }
+    auto svg = SvgSvg::FindDocument(static_cast<int32_t>(args[0].asNumber()));
+    if (!svg) {
+        return jsi::Value::null();
+    }
+    SvgSvg::PrepareTimings timings;
+    {
+        auto lock = svg->GetContext()->LockTreePreempting();
+        timings = svg->GetPrepareTimings();
+    }
+    if (timings.nodes == 0) {
+        return jsi::Value::null();
+    }
+    jsi::Object result(rt);
+    result.setProperty(rt, "nodes", static_cast<double>(timings.nodes));
+    result.setProperty(rt, "threads", static_cast<double>(timings.threads));
+    result.setProperty(rt, "geometryMs", timings.geometryMs);
+    result.setProperty(rt, "recordMs", timings.recordMs);
+    return result;
+}
+
 } // namespace rnoh
@@ -1,15 +1,30 @@
-
 #pragma once
 
-// This file was generated.
-
 #include "RNOH/ArkTSTurboModule.h"
 
 namespace rnoh {
 
+// toDataURL(tag, options, callback) renders the document natively: the image
+// is encoded on a worker thread and the callback receives its base64 on the
+// JS thread. Options are width and height in px, scale, format ("png" or
+// "jpeg") and quality.
+//
+// toDataURLBatch(items, limits, onResult, onDone) does the same for many
+// views at once, e.g. gallery thumbnails. Items carry the options above plus
+// tag and priority (lower first); limits are maxConcurrent and memoryBudget
+// in bytes. onResult(index, base64) is called as each image is encoded,
+// onDone() once after the last one.
+//
+// getPrepareTimings(tag) returns the phases of the view's last frame
+// preparation as {nodes, threads, geometryMs, recordMs}; null for an unknown
+// tag and until a frame with shapes was prepared.
 class JSI_EXPORT RNSVGSvgViewModule : public ArkTSTurboModule {
   public:
     RNSVGSvgViewModule(const ArkTSTurboModule::Context ctx, const std::string name);
+
+    facebook::jsi::Value toDataURL(facebook::jsi::Runtime &rt, const facebook::jsi::Value *args, size_t count);
+    facebook::jsi::Value toDataURLBatch(facebook::jsi::Runtime &rt, const facebook::jsi::Value *args, size_t count);
+    facebook::jsi::Value getPrepareTimings(facebook::jsi::Runtime &rt, const facebook::jsi::Value *args, size_t count);
 };
 
 } // namespace rnoh
@@ -0,0 +1,119 @@
+#include "ColorSpace.h"
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+namespace {
+constexpr size_t INVERSE_SIZE = 16384;
+constexpr float INVERSE_SCALE = static_cast<float>(INVERSE_SIZE - 1);
+constexpr float INV_255 = 1.0f / 255.0f;
+
+double CurveToLinear(double value)
+{
+    return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+}
+
+double CurveToSrgb(double value)
+{
+    return value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+}
+
+struct ColorSpaceTables {
+    float toLinear[256];
+    // indexed by linear * (INVERSE_SIZE - 1), fine enough that the dark end
+    // of the curve, where it is steepest, still lands on the right byte
+    uint8_t toSrgb[INVERSE_SIZE];
+    // 1 / alpha, 0 for transparent
+    float unpremultiply[256];
+
+    ColorSpaceTables()
+    {
+        for (int i = 0; i < 256; ++i) {
+            toLinear[i] = static_cast<float>(CurveToLinear(i / 255.0));
+            unpremultiply[i] = i == 0 ? 0.0f : 1.0f / i;
+        }
+        for (size_t i = 0; i < INVERSE_SIZE; ++i) {
+            toSrgb[i] = static_cast<uint8_t>(std::lround(CurveToSrgb(i / static_cast<double>(INVERSE_SCALE)) * 255.0));
+        }
+    }
+};
+
+const ColorSpaceTables& GetTables()
+{
+    static const ColorSpaceTables tables;
+    return tables;
+}
+
+uint8_t LookupSrgb(const ColorSpaceTables& tables, float value)
+{
+    const float index = std::min(std::max(value, 0.0f), 1.0f) * INVERSE_SCALE + 0.5f;
+    return tables.toSrgb[static_cast<size_t>(index)];
+}
+} // namespace
+
+float SrgbToLinear(uint8_t value)
+{
+    return GetTables().toLinear[value];
+}
+
+uint8_t LinearToSrgb(float value)
+{
+    return LookupSrgb(GetTables(), value);
+}
+
+void SrgbToLinearRow(uint8_t* pixels, size_t count)
+{
+    const auto& tables = GetTables();
+    for (size_t i = 0; i < count; ++i, pixels += 4) {
+        const uint32_t alpha = pixels[3];
+        if (alpha == 0) {
+            continue;
+        }
+        // unpremultiplied byte, looked up, premultiplied again
+        const float unpremultiply = 255.0f * tables.unpremultiply[alpha];
+        for (int c = 0; c < 3; ++c) {
+            const uint32_t color = std::min(static_cast<uint32_t>(pixels[c] * unpremultiply + 0.5f), 255u);
+            pixels[c] = static_cast<uint8_t>(tables.toLinear[color] * alpha + 0.5f);
+        }
+    }
+}
+
+void LinearToSrgbRow(uint8_t* pixels, size_t count)
+{
+    const auto& tables = GetTables();
+    for (size_t i = 0; i < count; ++i, pixels += 4) {
+        const uint32_t alpha = pixels[3];
+        if (alpha == 0) {
+            continue;
+        }
+        const float unpremultiply = tables.unpremultiply[alpha];
+        for (int c = 0; c < 3; ++c) {
+            const uint32_t color = LookupSrgb(tables, pixels[c] * unpremultiply);
+            pixels[c] = static_cast<uint8_t>((color * alpha + 127) / 255);
+        }
+    }
+}
+
+void SrgbToLinearStops(const uint32_t* colors, float* rgba, size_t count)
+{
+    const auto& tables = GetTables();
+    for (size_t i = 0; i < count; ++i, rgba += 4) {
+        const uint32_t color = colors[i];
+        rgba[0] = tables.toLinear[(color >> 16) & 0xff];
+        rgba[1] = tables.toLinear[(color >> 8) & 0xff];
+        rgba[2] = tables.toLinear[color & 0xff];
+        rgba[3] = (color >> 24) * INV_255;
+    }
+}
+
+void LinearToSrgbStops(const float* rgba, uint32_t* colors, size_t count)
+{
+    const auto& tables = GetTables();
+    for (size_t i = 0; i < count; ++i, rgba += 4) {
+        const uint32_t alpha = static_cast<uint32_t>(std::min(std::max(rgba[3], 0.0f), 1.0f) * 255.0f + 0.5f);
+        colors[i] = (alpha << 24) | (static_cast<uint32_t>(LookupSrgb(tables, rgba[0])) << 16) |
+                    (static_cast<uint32_t>(LookupSrgb(tables, rgba[1])) << 8) | LookupSrgb(tables, rgba[2]);
+    }
+}
+
+} // namespace rnoh
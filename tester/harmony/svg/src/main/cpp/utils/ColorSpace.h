@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace rnoh {
+
+// sRGB <-> linearRGB through the sRGB transfer curve, as color-interpolation
+// and color-interpolation-filters define them. Table driven: a 256 entry
+// forward table and a 16384 entry inverse one, no pow per call.
+
+// 0..255 sRGB to linear 0..1.
+float SrgbToLinear(uint8_t value);
+// Linear 0..1, clamped, to 0..255 sRGB.
+uint8_t LinearToSrgb(float value);
+
+// Premultiplied RGBA_8888 pixels in place, alpha untouched.
+void SrgbToLinearRow(uint8_t* pixels, size_t count);
+void LinearToSrgbRow(uint8_t* pixels, size_t count);
+
+// Gradient stops: ARGB colors to and from unpremultiplied linear RGBA
+// floats, four per stop.
+void SrgbToLinearStops(const uint32_t* colors, float* rgba, size_t count);
+void LinearToSrgbStops(const float* rgba, uint32_t* colors, size_t count);
+
+} // namespace rnoh
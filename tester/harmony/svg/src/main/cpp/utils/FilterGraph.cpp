@@ -0,0 +1,192 @@
+#include "FilterGraph.h"
+#include <cstring>
+#include "ColorSpace.h"
+
+namespace rnoh {
+namespace {
+FilterPixels GetPixels(OffscreenSurface& surface)
+{
+    return {surface.GetPixels(), surface.Width(), surface.Height()};
+}
+
+void ConvertSurface(OffscreenSurface& surface, bool toLinear)
+{
+    const size_t count = static_cast<size_t>(surface.Width()) * surface.Height();
+    if (toLinear) {
+        SrgbToLinearRow(surface.GetPixels(), count);
+    } else {
+        LinearToSrgbRow(surface.GetPixels(), count);
+    }
+}
+} // namespace
+
+void FilterSurfacePool::SetSize(uint32_t width, uint32_t height)
+{
+    if (width == width_ && height == height_) {
+        return;
+    }
+    free_.clear();
+    width_ = width;
+    height_ = height;
+}
+
+std::unique_ptr<OffscreenSurface> FilterSurfacePool::Acquire()
+{
+    if (!free_.empty()) {
+        auto surface = std::move(free_.back());
+        free_.pop_back();
+        std::memset(surface->GetPixels(), 0, static_cast<size_t>(width_) * height_ * 4);
+        return surface;
+    }
+    auto surface = std::make_unique<OffscreenSurface>(width_, height_);
+    if (!surface->IsValid()) {
+        return nullptr;
+    }
+    ++allocations_;
+    return surface;
+}
+
+void FilterSurfacePool::Release(std::unique_ptr<OffscreenSurface> surface)
+{
+    if (surface && surface->Width() == width_ && surface->Height() == height_) {
+        free_.push_back(std::move(surface));
+    }
+}
+
+size_t FilterGraph::ResolveInput(const SvgFeIn& input, size_t index) const
+{
+    switch (input.in) {
+        case SvgFeInType::SOURCE_GRAPHIC:
+            return SLOT_SOURCE_GRAPHIC;
+        case SvgFeInType::SOURCE_ALPHA:
+            return SLOT_SOURCE_ALPHA;
+        case SvgFeInType::PRIMITIVE:
+            break;
+        default:
+            return SLOT_TRANSPARENT;
+    }
+    if (!input.id.empty()) {
+        for (size_t i = index; i-- > 0;) {
+            if (effects_[i]->GetResult() == input.id) {
+                return SLOT_PRIMITIVES + i;
+            }
+        }
+    }
+    // no or an unknown reference reads the previous result
+    return index == 0 ? SLOT_SOURCE_GRAPHIC : SLOT_PRIMITIVES + index - 1;
+}
+
+void FilterGraph::Compile(std::vector<const FilterEffect*> effects)
+{
+    effects_ = std::move(effects);
+    const size_t count = effects_.size();
+    inputs_.assign(count, {});
+    std::vector<SvgFeIn> inputs;
+    for (size_t i = 0; i < count; ++i) {
+        inputs.clear();
+        effects_[i]->GetInputs(inputs);
+        for (const auto& input : inputs) {
+            inputs_[i].push_back(ResolveInput(input, i));
+        }
+    }
+
+    order_.clear();
+    readers_.assign(SLOT_PRIMITIVES + count, 0);
+    if (count == 0) {
+        return;
+    }
+    std::vector<bool> live(count, false);
+    live[count - 1] = true;
+    for (size_t i = count; i-- > 0;) {
+        for (size_t slot : inputs_[i]) {
+            if (live[i] && slot >= SLOT_PRIMITIVES) {
+                live[slot - SLOT_PRIMITIVES] = true;
+            }
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!live[i]) {
+            continue;
+        }
+        order_.push_back(i);
+        for (size_t slot : inputs_[i]) {
+            ++readers_[slot];
+        }
+    }
+    // SourceAlpha is derived from SourceGraphic
+    if (readers_[SLOT_SOURCE_ALPHA] > 0) {
+        ++readers_[SLOT_SOURCE_GRAPHIC];
+    }
+}
+
+std::unique_ptr<OffscreenSurface> FilterGraph::Run(FilterSurfacePool& pool, std::unique_ptr<OffscreenSurface> source,
+                                                   const std::vector<PixelRect>& regions,
+                                                   const FilterUnits& units) const
+{
+    if (order_.empty() || !source || regions.size() != effects_.size()) {
+        return nullptr;
+    }
+    const PixelRect whole{0, 0, static_cast<int32_t>(source->Width()), static_cast<int32_t>(source->Height())};
+    std::vector<std::unique_ptr<OffscreenSurface>> slots(readers_.size());
+    std::vector<uint32_t> remaining = readers_;
+    // whether a slot holds linearRGB; readers in the other space convert it
+    std::vector<bool> linear(readers_.size(), false);
+    slots[SLOT_SOURCE_GRAPHIC] = std::move(source);
+    auto release = [&](size_t slot) {
+        if (--remaining[slot] == 0) {
+            pool.Release(std::move(slots[slot]));
+        }
+    };
+
+    std::vector<FilterPixels> inputs;
+    for (size_t index : order_) {
+        for (size_t slot : inputs_[index]) {
+            if (slots[slot]) {
+                continue;
+            }
+            // primitive results always exist before their readers run
+            slots[slot] = pool.Acquire();
+            if (slot == SLOT_SOURCE_ALPHA && slots[slot]) {
+                ExtractAlpha(GetPixels(*slots[SLOT_SOURCE_GRAPHIC]), GetPixels(*slots[slot]), whole);
+                release(SLOT_SOURCE_GRAPHIC);
+            }
+        }
+        auto output = pool.Acquire();
+        const bool toLinear = effects_[index]->GetColorInterpolation() == SvgColorInterpolationType::LINEAR_RGB;
+        inputs.clear();
+        for (size_t slot : inputs_[index]) {
+            if (!slots[slot]) {
+                return nullptr;
+            }
+            // alpha only images look the same in both spaces
+            if (linear[slot] != toLinear && slot != SLOT_SOURCE_ALPHA && slot != SLOT_TRANSPARENT) {
+                ConvertSurface(*slots[slot], toLinear);
+                linear[slot] = toLinear;
+            }
+            inputs.push_back(GetPixels(*slots[slot]));
+        }
+        if (!output) {
+            return nullptr;
+        }
+        if (!regions[index].IsEmpty()) {
+            effects_[index]->Apply(inputs, GetPixels(*output), regions[index], units);
+        }
+        for (size_t slot : inputs_[index]) {
+            release(slot);
+        }
+        slots[SLOT_PRIMITIVES + index] = std::move(output);
+        linear[SLOT_PRIMITIVES + index] = toLinear;
+    }
+
+    auto result = std::move(slots[SLOT_PRIMITIVES + order_.back()]);
+    if (result && linear[SLOT_PRIMITIVES + order_.back()]) {
+        ConvertSurface(*result, false);
+    }
+    // e.g. SourceGraphic when no primitive read it
+    for (auto& slot : slots) {
+        pool.Release(std::move(slot));
+    }
+    return result;
+}
+
+} // namespace rnoh
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FilterKernels.h"
+#include "OffscreenSurface.h"
+#include "SvgAttributesParser.h"
+
+namespace rnoh {
+
+// Pixels per unit of primitive lengths such as stdDeviation or dx.
+struct FilterUnits {
+    float scaleX = 1.0f;
+    float scaleY = 1.0f;
+};
+
+// One filter primitive. Inputs and output cover the whole filter region, the
+// primitive writes its output inside region only.
+class FilterEffect {
+public:
+    virtual ~FilterEffect() = default;
+
+    // in, then in2 for primitives reading two images
+    virtual void GetInputs(std::vector<SvgFeIn>& inputs) const = 0;
+    virtual const std::string& GetResult() const = 0;
+    // Space inputs are handed over in and the output is written in; LINEAR_RGB
+    // for linearRGB, anything else is sRGB.
+    virtual SvgColorInterpolationType GetColorInterpolation() const
+    {
+        return SvgColorInterpolationType::SRGB;
+    }
+    virtual void Apply(const std::vector<FilterPixels>& inputs, const FilterPixels& output, const PixelRect& region,
+                       const FilterUnits& units) const = 0;
+};
+
+// Equally sized buffers reused across primitives and frames.
+class FilterSurfacePool {
+public:
+    // Drops the pooled surfaces when the size changes.
+    void SetSize(uint32_t width, uint32_t height);
+    // A cleared surface, nullptr when it cannot be allocated.
+    std::unique_ptr<OffscreenSurface> Acquire();
+    void Release(std::unique_ptr<OffscreenSurface> surface);
+
+    // surfaces allocated since the pool was created
+    size_t GetAllocations() const
+    {
+        return allocations_;
+    }
+
+private:
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    std::vector<std::unique_ptr<OffscreenSurface>> free_;
+    size_t allocations_ = 0;
+};
+
+// The primitives of a <filter> as a dependency graph. Compile resolves the
+// in/in2/result references once; Run executes the primitives the last one
+// depends on in dependency order and hands each buffer back to the pool as
+// soon as its last reader ran. Buffers are converted between sRGB and
+// linearRGB in place when a primitive works in the other space.
+class FilterGraph {
+public:
+    void Compile(std::vector<const FilterEffect*> effects);
+
+    bool IsEmpty() const
+    {
+        return order_.empty();
+    }
+
+    // Runs the graph on source, the rendered SourceGraphic. regions holds the
+    // subregion of every compiled effect. Returns the result of the last
+    // primitive, nullptr when nothing is drawn.
+    std::unique_ptr<OffscreenSurface> Run(FilterSurfacePool& pool, std::unique_ptr<OffscreenSurface> source,
+                                          const std::vector<PixelRect>& regions, const FilterUnits& units) const;
+
+private:
+    // slots before the primitive results
+    enum Slot : size_t {
+        SLOT_SOURCE_GRAPHIC = 0,
+        SLOT_SOURCE_ALPHA,
+        // BackgroundImage, FillPaint and friends, not rendered
+        SLOT_TRANSPARENT,
+        SLOT_PRIMITIVES,
+    };
+
+    size_t ResolveInput(const SvgFeIn& input, size_t index) const;
+
+    std::vector<const FilterEffect*> effects_;
+    // input slots of each effect
+    std::vector<std::vector<size_t>> inputs_;
+    // effects the last one depends on, in document order, which is a
+    // topological order as references only reach back
+    std::vector<size_t> order_;
+    // readers of every slot among the effects in order_
+    std::vector<uint32_t> readers_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,214 @@
+#include "FilterKernels.h"
+#include "FilterSimd.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace rnoh {
+namespace {
+constexpr float PI = 3.14159265358979f;
+constexpr float DEG_TO_RAD = PI / 180.0f;
+constexpr int32_t BLUR_BAND_ROWS = 32;
+constexpr int32_t BLUR_STRIP_COLUMNS = 64;
+
+// Box size d of the three box blurs standing in for a gaussian of sigma.
+int32_t GetBoxSize(float sigma)
+{
+    return static_cast<int32_t>(std::floor(sigma * 3.0f * std::sqrt(2.0f * PI) / 4.0f + 0.5f));
+}
+
+// {left, right} reach of the three passes; an even size is split around the
+// pixel, the last pass is one wider.
+void GetBoxPasses(int32_t boxSize, int32_t passes[3][2])
+{
+    const int32_t half = boxSize / 2;
+    const int32_t shorter = boxSize % 2 ? half : half - 1;
+    passes[0][0] = half;
+    passes[0][1] = shorter;
+    passes[1][0] = shorter;
+    passes[1][1] = half;
+    passes[2][0] = half;
+    passes[2][1] = half;
+}
+} // namespace
+
+void FillRect(const FilterPixels& dst, const PixelRect& rect, const uint8_t premultiplied[4])
+{
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        uint8_t* out = dst.Row(y) + rect.left * 4;
+        for (int32_t x = rect.left; x < rect.right; ++x, out += 4) {
+            std::memcpy(out, premultiplied, 4);
+        }
+    }
+}
+
+void OffsetRect(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, int32_t dx, int32_t dy)
+{
+    const int32_t left = std::max(rect.left, dx);
+    const int32_t right = std::min(rect.right, static_cast<int32_t>(src.width) + dx);
+    const int32_t top = std::max(rect.top, dy);
+    const int32_t bottom = std::min(rect.bottom, static_cast<int32_t>(src.height) + dy);
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        uint8_t* out = dst.Row(y) + rect.left * 4;
+        std::memset(out, 0, static_cast<size_t>(rect.Width()) * 4);
+        if (y < top || y >= bottom || left >= right) {
+            continue;
+        }
+        std::memcpy(dst.Row(y) + left * 4, src.Row(y - dy) + (left - dx) * 4, static_cast<size_t>(right - left) * 4);
+    }
+}
+
+void ExtractAlpha(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect)
+{
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        const uint8_t* in = src.Row(y) + rect.left * 4;
+        uint8_t* out = dst.Row(y) + rect.left * 4;
+        for (int32_t x = rect.left; x < rect.right; ++x, in += 4, out += 4) {
+            out[0] = 0;
+            out[1] = 0;
+            out[2] = 0;
+            out[3] = in[3];
+        }
+    }
+}
+
+void GaussianBlur(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, float sigmaX, float sigmaY,
+                  SvgFeEdgeMode edgeMode)
+{
+    const auto& kernels = GetFilterKernels();
+    auto& pool = WorkerPool::GetInstance();
+    const int32_t width = rect.Width();
+    const int32_t height = rect.Height();
+    const size_t stride = static_cast<size_t>(dst.width) * 4;
+    int32_t passesX[3][2];
+    int32_t passesY[3][2];
+    const int32_t boxX = GetBoxSize(sigmaX);
+    const int32_t boxY = GetBoxSize(sigmaY);
+    GetBoxPasses(boxX, passesX);
+    GetBoxPasses(boxY, passesY);
+
+    // rows are independent along x, bands of them go to the pool
+    const size_t bands = static_cast<size_t>((height + BLUR_BAND_ROWS - 1) / BLUR_BAND_ROWS);
+    pool.ParallelFor(bands, [&](size_t band) {
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+        const int32_t top = rect.top + static_cast<int32_t>(band) * BLUR_BAND_ROWS;
+        const int32_t bottom = std::min(rect.bottom, top + BLUR_BAND_ROWS);
+        thread_local std::vector<uint8_t> front;
+        thread_local std::vector<uint8_t> back;
+        front.resize(rowBytes);
+        back.resize(rowBytes);
+        for (int32_t y = top; y < bottom; ++y) {
+            const uint8_t* in = src.Row(y) + rect.left * 4;
+            uint8_t* out = dst.Row(y) + rect.left * 4;
+            if (boxX <= 0) {
+                std::memcpy(out, in, rowBytes);
+                continue;
+            }
+            kernels.boxLine(in, front.data(), width, passesX[0][0], passesX[0][1], edgeMode);
+            kernels.boxLine(front.data(), back.data(), width, passesX[1][0], passesX[1][1], edgeMode);
+            kernels.boxLine(back.data(), out, width, passesX[2][0], passesX[2][1], edgeMode);
+        }
+    });
+    if (boxY <= 0) {
+        return;
+    }
+
+    // and columns along y; each strip bounces between dst and a packed copy
+    const size_t strips = static_cast<size_t>((width + BLUR_STRIP_COLUMNS - 1) / BLUR_STRIP_COLUMNS);
+    pool.ParallelFor(strips, [&](size_t strip) {
+        const int32_t left = rect.left + static_cast<int32_t>(strip) * BLUR_STRIP_COLUMNS;
+        const size_t bytes = static_cast<size_t>(std::min(rect.right, left + BLUR_STRIP_COLUMNS) - left) * 4;
+        thread_local std::vector<uint8_t> plane;
+        thread_local std::vector<float> sums;
+        plane.resize(bytes * height);
+        sums.resize(bytes);
+        uint8_t* origin = dst.Row(rect.top) + left * 4;
+        kernels.boxRows(origin, stride, plane.data(), bytes, bytes, height, passesY[0][0], passesY[0][1], edgeMode,
+                        sums.data());
+        kernels.boxRows(plane.data(), bytes, origin, stride, bytes, height, passesY[1][0], passesY[1][1], edgeMode,
+                        sums.data());
+        kernels.boxRows(origin, stride, plane.data(), bytes, bytes, height, passesY[2][0], passesY[2][1], edgeMode,
+                        sums.data());
+        for (int32_t y = 0; y < height; ++y) {
+            std::memcpy(origin + y * stride, plane.data() + y * bytes, bytes);
+        }
+    });
+}
+
+void BuildColorMatrix(SvgFeColorMatrixType type, const std::vector<float>& values, float matrix[20])
+{
+    static const float IDENTITY[20] = {1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0};
+    std::copy(IDENTITY, IDENTITY + 20, matrix);
+    switch (type) {
+        case SvgFeColorMatrixType::MATRIX:
+            if (values.size() == 20) {
+                std::copy(values.begin(), values.end(), matrix);
+            }
+            break;
+        case SvgFeColorMatrixType::SATURATE: {
+            const float s = values.empty() ? 1.0f : values[0];
+            const float saturate[20] = {
+                0.213f + 0.787f * s, 0.715f - 0.715f * s, 0.072f - 0.072f * s, 0, 0,
+                0.213f - 0.213f * s, 0.715f + 0.285f * s, 0.072f - 0.072f * s, 0, 0,
+                0.213f - 0.213f * s, 0.715f - 0.715f * s, 0.072f + 0.928f * s, 0, 0,
+                0, 0, 0, 1, 0,
+            };
+            std::copy(saturate, saturate + 20, matrix);
+            break;
+        }
+        case SvgFeColorMatrixType::HUE_ROTATE: {
+            const float angle = (values.empty() ? 0.0f : values[0]) * DEG_TO_RAD;
+            const float c = std::cos(angle);
+            const float s = std::sin(angle);
+            const float hue[20] = {
+                0.213f + c * 0.787f - s * 0.213f, 0.715f - c * 0.715f - s * 0.715f, 0.072f - c * 0.072f + s * 0.928f, 0, 0,
+                0.213f - c * 0.213f + s * 0.143f, 0.715f + c * 0.285f + s * 0.140f, 0.072f - c * 0.072f - s * 0.283f, 0, 0,
+                0.213f - c * 0.213f - s * 0.787f, 0.715f - c * 0.715f + s * 0.715f, 0.072f + c * 0.928f + s * 0.072f, 0, 0,
+                0, 0, 0, 1, 0,
+            };
+            std::copy(hue, hue + 20, matrix);
+            break;
+        }
+        case SvgFeColorMatrixType::LUMINACE_TO_ALPHA: {
+            const float luminance[20] = {
+                0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0,
+                0.2125f, 0.7154f, 0.0721f, 0, 0,
+            };
+            std::copy(luminance, luminance + 20, matrix);
+            break;
+        }
+    }
+}
+
+void ColorMatrix(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, const float matrix[20])
+{
+    const auto& kernels = GetFilterKernels();
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        kernels.colorMatrix(src.Row(y) + rect.left * 4, dst.Row(y) + rect.left * 4, rect.Width(), matrix);
+    }
+}
+
+void Composite(const FilterPixels& in, const FilterPixels& in2, const FilterPixels& dst, const PixelRect& rect,
+               SvgFeOperatorType op, const float k[4])
+{
+    const auto& kernels = GetFilterKernels();
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        const size_t offset = static_cast<size_t>(rect.left) * 4;
+        kernels.composite(in.Row(y) + offset, in2.Row(y) + offset, dst.Row(y) + offset, rect.Width(), op, k);
+    }
+}
+
+void Blend(const FilterPixels& in, const FilterPixels& in2, const FilterPixels& dst, const PixelRect& rect,
+           SvgFeBlendMode mode)
+{
+    const auto& kernels = GetFilterKernels();
+    for (int32_t y = rect.top; y < rect.bottom; ++y) {
+        const size_t offset = static_cast<size_t>(rect.left) * 4;
+        kernels.blend(in.Row(y) + offset, in2.Row(y) + offset, dst.Row(y) + offset, rect.Width(), mode);
+    }
+}
+
+} // namespace rnoh
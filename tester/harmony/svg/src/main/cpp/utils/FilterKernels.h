@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SvgAttributesParser.h"
+
+namespace rnoh {
+
+// Pixel rectangle, right and bottom exclusive.
+struct PixelRect {
+    int32_t left = 0;
+    int32_t top = 0;
+    int32_t right = 0;
+    int32_t bottom = 0;
+
+    int32_t Width() const
+    {
+        return right - left;
+    }
+    int32_t Height() const
+    {
+        return bottom - top;
+    }
+    bool IsEmpty() const
+    {
+        return right <= left || bottom <= top;
+    }
+};
+
+// Premultiplied RGBA_8888 pixels of a filter buffer, rows without padding.
+struct FilterPixels {
+    uint8_t* data = nullptr;
+    uint32_t width = 0;
+    uint32_t height = 0;
+
+    uint8_t* Row(int32_t y) const
+    {
+        return data + static_cast<size_t>(y) * width * 4;
+    }
+};
+
+// Every kernel writes dst inside rect only, sources are read inside rect
+// unless stated otherwise. dst may not alias a source.
+
+void FillRect(const FilterPixels& dst, const PixelRect& rect, const uint8_t premultiplied[4]);
+
+// dst(x, y) = src(x - dx, y - dy), transparent where that falls outside src.
+void OffsetRect(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, int32_t dx, int32_t dy);
+
+// SourceAlpha: the alpha of src with black color.
+void ExtractAlpha(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect);
+
+// feGaussianBlur approximated by three box blurs per direction, deviations in
+// pixels; edgeMode decides what is read past the edges of rect.
+void GaussianBlur(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, float sigmaX, float sigmaY,
+                  SvgFeEdgeMode edgeMode);
+
+// Row major 4x5 matrix on unpremultiplied colors in 0..1.
+void BuildColorMatrix(SvgFeColorMatrixType type, const std::vector<float>& values, float matrix[20]);
+void ColorMatrix(const FilterPixels& src, const FilterPixels& dst, const PixelRect& rect, const float matrix[20]);
+
+// Porter-Duff operators and arithmetic with k = {k1, k2, k3, k4}; in is the
+// source, in2 the destination.
+void Composite(const FilterPixels& in, const FilterPixels& in2, const FilterPixels& dst, const PixelRect& rect,
+               SvgFeOperatorType op, const float k[4]);
+
+// in blended over the backdrop in2.
+void Blend(const FilterPixels& in, const FilterPixels& in2, const FilterPixels& dst, const PixelRect& rect,
+           SvgFeBlendMode mode);
+
+} // namespace rnoh
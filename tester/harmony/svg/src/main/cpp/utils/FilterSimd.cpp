@@ -0,0 +1,35 @@
+#include "FilterSimd.h"
+#include "FilterSimdImpl.h"
+
+namespace rnoh {
+
+const FilterKernelTable& GetScalarFilterKernels()
+{
+    static const FilterKernelTable table = MakeFilterKernelTable<ScalarVec>("scalar");
+    return table;
+}
+
+const FilterKernelTable& GetFilterKernels()
+{
+    static const FilterKernelTable& table = []() -> const FilterKernelTable& {
+#if RNOH_SVG_FILTER_NEON
+        // part of every arm64 target
+        static const FilterKernelTable neon = MakeFilterKernelTable<NeonVec>("neon");
+        return neon;
+#elif RNOH_SVG_FILTER_SSE2
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return GetAvx2FilterKernels();
+        }
+#endif
+        static const FilterKernelTable sse2 = MakeFilterKernelTable<Sse2Vec>("sse2");
+        return sse2;
+#else
+        return GetScalarFilterKernels();
+#endif
+    }();
+    return table;
+}
+
+} // namespace rnoh
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "SvgAttributesParser.h"
+
+namespace rnoh {
+
+// Row kernels behind the filter primitives, premultiplied RGBA_8888 in and
+// out. One table per instruction set, picked once at runtime.
+struct FilterKernelTable {
+    const char* name;
+    // One box pass over a line of n pixels averaging [i - left, i + right].
+    void (*boxLine)(const uint8_t* in, uint8_t* out, int32_t n, int32_t left, int32_t right, SvgFeEdgeMode mode);
+    // The same pass down n rows of bytes each, rows at the given strides.
+    // sums is scratch of bytes floats.
+    void (*boxRows)(const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t bytes, int32_t n,
+                    int32_t left, int32_t right, SvgFeEdgeMode mode, float* sums);
+    void (*colorMatrix)(const uint8_t* in, uint8_t* out, int32_t count, const float matrix[20]);
+    void (*composite)(const uint8_t* in, const uint8_t* in2, uint8_t* out, int32_t count, SvgFeOperatorType op,
+                      const float k[4]);
+    void (*blend)(const uint8_t* in, const uint8_t* in2, uint8_t* out, int32_t count, SvgFeBlendMode mode);
+};
+
+// The fastest table the CPU runs: NEON on ARM, AVX2 or SSE2 on x86, scalar
+// elsewhere.
+const FilterKernelTable& GetFilterKernels();
+// Reference implementation, also the fallback.
+const FilterKernelTable& GetScalarFilterKernels();
+#if defined(__x86_64__)
+// Requires a CPU with AVX2.
+const FilterKernelTable& GetAvx2FilterKernels();
+#endif
+
+} // namespace rnoh
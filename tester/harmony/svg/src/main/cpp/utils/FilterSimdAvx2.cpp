@@ -0,0 +1,21 @@
+// Built for the baseline like the rest of the library, only the AVX2
+// kernels carry the AVX2 target. Only reached after GetFilterKernels checked
+// the CPU.
+#include "FilterSimd.h"
+#include "FilterSimdImpl.h"
+
+namespace rnoh {
+
+#if defined(__x86_64__)
+const FilterKernelTable& GetAvx2FilterKernels()
+{
+#if RNOH_SVG_FILTER_AVX2
+    static const FilterKernelTable table = MakeFilterKernelTable<Sse2Vec, Avx2Vec>("avx2");
+#else
+    static const FilterKernelTable table = MakeFilterKernelTable<Sse2Vec>("sse2");
+#endif
+    return table;
+}
+#endif
+
+} // namespace rnoh
@@ -0,0 +1,502 @@
+#pragma once
+// Kernel templates behind FilterKernelTable, instantiated once per vector
+// type. Only included by the FilterSimd translation units. Everything is
+// built for the baseline instruction set; the AVX2 code carries
+// RNOH_SVG_TARGET_AVX2 on its own functions, so no other code of the library
+// can end up with AVX2 instructions.
+#include <algorithm>
+#include <cstring>
+#include "FilterSimd.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RNOH_SVG_FILTER_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RNOH_SVG_FILTER_SSE2 1
+#endif
+#if RNOH_SVG_FILTER_SSE2 && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define RNOH_SVG_FILTER_AVX2 1
+#define RNOH_SVG_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace rnoh {
+namespace {
+constexpr float FILTER_INV_255 = 1.0f / 255.0f;
+
+// Index read for position i of a line of n pixels, -1 for transparent.
+inline int32_t EdgeIndex(int32_t i, int32_t n, SvgFeEdgeMode mode)
+{
+    if (i >= 0 && i < n) {
+        return i;
+    }
+    switch (mode) {
+        case SvgFeEdgeMode::EDGE_DUPLICATE:
+            return i < 0 ? 0 : n - 1;
+        case SvgFeEdgeMode::EDGE_WRAP: {
+            const int32_t wrapped = i % n;
+            return wrapped < 0 ? wrapped + n : wrapped;
+        }
+        default:
+            return -1;
+    }
+}
+
+// The vector types share one interface: WIDTH float lanes loaded from and
+// stored to as many bytes, StoreBytes clamping to 0..255 and rounding.
+
+struct ScalarVec {
+    static constexpr size_t WIDTH = 4;
+    float v[4];
+
+    static ScalarVec Splat(float x)
+    {
+        return {{x, x, x, x}};
+    }
+    static ScalarVec Set(float r, float g, float b, float a)
+    {
+        return {{r, g, b, a}};
+    }
+    static ScalarVec Load(const float* p)
+    {
+        return {{p[0], p[1], p[2], p[3]}};
+    }
+    static ScalarVec LoadBytes(const uint8_t* p)
+    {
+        return {{static_cast<float>(p[0]), static_cast<float>(p[1]), static_cast<float>(p[2]),
+                 static_cast<float>(p[3])}};
+    }
+    void Store(float* p) const
+    {
+        std::copy(v, v + 4, p);
+    }
+    void StoreBytes(uint8_t* p) const
+    {
+        for (int i = 0; i < 4; ++i) {
+            p[i] = static_cast<uint8_t>(std::min(std::max(v[i], 0.0f), 255.0f) + 0.5f);
+        }
+    }
+    float Alpha() const
+    {
+        return v[3];
+    }
+    static ScalarVec Min(const ScalarVec& a, const ScalarVec& b)
+    {
+        return {{std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]),
+                 std::min(a.v[3], b.v[3])}};
+    }
+    static ScalarVec Max(const ScalarVec& a, const ScalarVec& b)
+    {
+        return {{std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]),
+                 std::max(a.v[3], b.v[3])}};
+    }
+    friend ScalarVec operator+(const ScalarVec& a, const ScalarVec& b)
+    {
+        return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+    }
+    friend ScalarVec operator-(const ScalarVec& a, const ScalarVec& b)
+    {
+        return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+    }
+    friend ScalarVec operator*(const ScalarVec& a, const ScalarVec& b)
+    {
+        return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+    }
+};
+
+#if RNOH_SVG_FILTER_NEON
+struct NeonVec {
+    static constexpr size_t WIDTH = 4;
+    float32x4_t v;
+
+    static NeonVec Splat(float x)
+    {
+        return {vdupq_n_f32(x)};
+    }
+    static NeonVec Set(float r, float g, float b, float a)
+    {
+        const float lanes[4] = {r, g, b, a};
+        return {vld1q_f32(lanes)};
+    }
+    static NeonVec Load(const float* p)
+    {
+        return {vld1q_f32(p)};
+    }
+    static NeonVec LoadBytes(const uint8_t* p)
+    {
+        uint32_t word;
+        std::memcpy(&word, p, 4);
+        const uint16x8_t wide = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(word)));
+        return {vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)))};
+    }
+    void Store(float* p) const
+    {
+        vst1q_f32(p, v);
+    }
+    void StoreBytes(uint8_t* p) const
+    {
+        const float32x4_t clamped = vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+        const uint16x4_t narrow = vmovn_u32(vcvtq_u32_f32(vaddq_f32(clamped, vdupq_n_f32(0.5f))));
+        const uint8x8_t bytes = vmovn_u16(vcombine_u16(narrow, narrow));
+        const uint32_t word = vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+        std::memcpy(p, &word, 4);
+    }
+    float Alpha() const
+    {
+        return vgetq_lane_f32(v, 3);
+    }
+    static NeonVec Min(const NeonVec& a, const NeonVec& b)
+    {
+        return {vminq_f32(a.v, b.v)};
+    }
+    static NeonVec Max(const NeonVec& a, const NeonVec& b)
+    {
+        return {vmaxq_f32(a.v, b.v)};
+    }
+    friend NeonVec operator+(const NeonVec& a, const NeonVec& b)
+    {
+        return {vaddq_f32(a.v, b.v)};
+    }
+    friend NeonVec operator-(const NeonVec& a, const NeonVec& b)
+    {
+        return {vsubq_f32(a.v, b.v)};
+    }
+    friend NeonVec operator*(const NeonVec& a, const NeonVec& b)
+    {
+        return {vmulq_f32(a.v, b.v)};
+    }
+};
+#endif
+
+#if RNOH_SVG_FILTER_SSE2
+struct Sse2Vec {
+    static constexpr size_t WIDTH = 4;
+    __m128 v;
+
+    static Sse2Vec Splat(float x)
+    {
+        return {_mm_set1_ps(x)};
+    }
+    static Sse2Vec Set(float r, float g, float b, float a)
+    {
+        return {_mm_setr_ps(r, g, b, a)};
+    }
+    static Sse2Vec Load(const float* p)
+    {
+        return {_mm_loadu_ps(p)};
+    }
+    static Sse2Vec LoadBytes(const uint8_t* p)
+    {
+        int32_t word;
+        std::memcpy(&word, p, 4);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(word), zero), zero);
+        return {_mm_cvtepi32_ps(wide)};
+    }
+    void Store(float* p) const
+    {
+        _mm_storeu_ps(p, v);
+    }
+    void StoreBytes(uint8_t* p) const
+    {
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+        const __m128i words = _mm_cvttps_epi32(_mm_add_ps(clamped, _mm_set1_ps(0.5f)));
+        const __m128i shorts = _mm_packs_epi32(words, words);
+        const int32_t word = _mm_cvtsi128_si32(_mm_packus_epi16(shorts, shorts));
+        std::memcpy(p, &word, 4);
+    }
+    float Alpha() const
+    {
+        return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    static Sse2Vec Min(const Sse2Vec& a, const Sse2Vec& b)
+    {
+        return {_mm_min_ps(a.v, b.v)};
+    }
+    static Sse2Vec Max(const Sse2Vec& a, const Sse2Vec& b)
+    {
+        return {_mm_max_ps(a.v, b.v)};
+    }
+    friend Sse2Vec operator+(const Sse2Vec& a, const Sse2Vec& b)
+    {
+        return {_mm_add_ps(a.v, b.v)};
+    }
+    friend Sse2Vec operator-(const Sse2Vec& a, const Sse2Vec& b)
+    {
+        return {_mm_sub_ps(a.v, b.v)};
+    }
+    friend Sse2Vec operator*(const Sse2Vec& a, const Sse2Vec& b)
+    {
+        return {_mm_mul_ps(a.v, b.v)};
+    }
+};
+#endif
+
+#if RNOH_SVG_FILTER_AVX2
+// Eight lanes, only for the wide loops of BoxRowsT: the per pixel kernels
+// have four channels to work on.
+struct Avx2Vec {
+    static constexpr size_t WIDTH = 8;
+    __m256 v;
+
+    RNOH_SVG_TARGET_AVX2 static Avx2Vec Splat(float x)
+    {
+        return {_mm256_set1_ps(x)};
+    }
+    RNOH_SVG_TARGET_AVX2 static Avx2Vec Load(const float* p)
+    {
+        return {_mm256_loadu_ps(p)};
+    }
+    RNOH_SVG_TARGET_AVX2 static Avx2Vec LoadBytes(const uint8_t* p)
+    {
+        const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return {_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes))};
+    }
+    RNOH_SVG_TARGET_AVX2 void Store(float* p) const
+    {
+        _mm256_storeu_ps(p, v);
+    }
+    RNOH_SVG_TARGET_AVX2 void StoreBytes(uint8_t* p) const
+    {
+        const __m256 clamped = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(255.0f));
+        const __m256i words = _mm256_cvttps_epi32(_mm256_add_ps(clamped, _mm256_set1_ps(0.5f)));
+        const __m128i shorts =
+            _mm_packs_epi32(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(shorts, shorts));
+    }
+    RNOH_SVG_TARGET_AVX2 friend Avx2Vec operator+(const Avx2Vec& a, const Avx2Vec& b)
+    {
+        return {_mm256_add_ps(a.v, b.v)};
+    }
+    RNOH_SVG_TARGET_AVX2 friend Avx2Vec operator-(const Avx2Vec& a, const Avx2Vec& b)
+    {
+        return {_mm256_sub_ps(a.v, b.v)};
+    }
+    RNOH_SVG_TARGET_AVX2 friend Avx2Vec operator*(const Avx2Vec& a, const Avx2Vec& b)
+    {
+        return {_mm256_mul_ps(a.v, b.v)};
+    }
+};
+#endif
+
+// Box pass along a line, one pixel per step with its four channels in the
+// lanes of V. Sums of bytes stay exact in float.
+template <typename V>
+void BoxLineT(const uint8_t* in, uint8_t* out, int32_t n, int32_t left, int32_t right, SvgFeEdgeMode mode)
+{
+    const V scale = V::Splat(1.0f / static_cast<float>(left + right + 1));
+    V sum = V::Splat(0.0f);
+    for (int32_t k = -left; k <= right; ++k) {
+        const int32_t j = EdgeIndex(k, n, mode);
+        if (j >= 0) {
+            sum = sum + V::LoadBytes(in + j * 4);
+        }
+    }
+    auto edgeSteps = [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; ++i) {
+            (sum * scale).StoreBytes(out + i * 4);
+            const int32_t enter = EdgeIndex(i + right + 1, n, mode);
+            const int32_t leave = EdgeIndex(i - left, n, mode);
+            if (enter >= 0) {
+                sum = sum + V::LoadBytes(in + enter * 4);
+            }
+            if (leave >= 0) {
+                sum = sum - V::LoadBytes(in + leave * 4);
+            }
+        }
+    };
+    // between the edges both ends of the window are inside the line; the
+    // difference is taken first to keep a single add on the dependency chain
+    const int32_t interiorBegin = std::min(left, n);
+    const int32_t interiorEnd = std::max(interiorBegin, n - right - 1);
+    edgeSteps(0, interiorBegin);
+    for (int32_t i = interiorBegin; i < interiorEnd; ++i) {
+        (sum * scale).StoreBytes(out + i * 4);
+        sum = sum + (V::LoadBytes(in + (i + right + 1) * 4) - V::LoadBytes(in + (i - left) * 4));
+    }
+    edgeSteps(interiorEnd, n);
+}
+
+// Writes the average in sums to out when given, then adds the entering row and
+// takes the leaving one away, from byte x on. Returns where it stopped.
+template <typename V>
+size_t BoxRowSpan(float* sums, uint8_t* out, const uint8_t* enter, const uint8_t* leave, size_t x, size_t bytes,
+                  float scale)
+{
+    const V scaleV = V::Splat(scale);
+    for (; x + V::WIDTH <= bytes; x += V::WIDTH) {
+        V sum = V::Load(sums + x);
+        if (out != nullptr) {
+            (sum * scaleV).StoreBytes(out + x);
+        }
+        if (enter != nullptr) {
+            sum = sum + V::LoadBytes(enter + x);
+        }
+        if (leave != nullptr) {
+            sum = sum - V::LoadBytes(leave + x);
+        }
+        sum.Store(sums + x);
+    }
+    return x;
+}
+
+#if RNOH_SVG_FILTER_AVX2
+// The same loop with the AVX2 target, which the template cannot carry.
+template <>
+RNOH_SVG_TARGET_AVX2 size_t BoxRowSpan<Avx2Vec>(float* sums, uint8_t* out, const uint8_t* enter,
+                                                const uint8_t* leave, size_t x, size_t bytes, float scale)
+{
+    const Avx2Vec scaleV = Avx2Vec::Splat(scale);
+    for (; x + Avx2Vec::WIDTH <= bytes; x += Avx2Vec::WIDTH) {
+        Avx2Vec sum = Avx2Vec::Load(sums + x);
+        if (out != nullptr) {
+            (sum * scaleV).StoreBytes(out + x);
+        }
+        if (enter != nullptr) {
+            sum = sum + Avx2Vec::LoadBytes(enter + x);
+        }
+        if (leave != nullptr) {
+            sum = sum - Avx2Vec::LoadBytes(leave + x);
+        }
+        sum.Store(sums + x);
+    }
+    return x;
+}
+#endif
+
+// Box pass down the columns: a running sum per byte of the row, so every step
+// streams whole rows instead of gathering columns. Tail covers what is left of
+// a row after the wide V, at most one pixel.
+template <typename V, typename Tail>
+void BoxRowsT(const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t bytes, int32_t n,
+              int32_t left, int32_t right, SvgFeEdgeMode mode, float* sums)
+{
+    const float scale = 1.0f / static_cast<float>(left + right + 1);
+    auto step = [&](uint8_t* row, int32_t enter, int32_t leave) {
+        const uint8_t* enterRow = enter >= 0 ? in + enter * inStride : nullptr;
+        const uint8_t* leaveRow = leave >= 0 ? in + leave * inStride : nullptr;
+        const size_t x = BoxRowSpan<V>(sums, row, enterRow, leaveRow, 0, bytes, scale);
+        BoxRowSpan<Tail>(sums, row, enterRow, leaveRow, x, bytes, scale);
+    };
+    std::fill(sums, sums + bytes, 0.0f);
+    for (int32_t k = -left; k <= right; ++k) {
+        step(nullptr, EdgeIndex(k, n, mode), -1);
+    }
+    for (int32_t y = 0; y < n; ++y) {
+        step(out + y * outStride, EdgeIndex(y + right + 1, n, mode), EdgeIndex(y - left, n, mode));
+    }
+}
+
+template <typename V>
+void ColorMatrixT(const uint8_t* in, uint8_t* out, int32_t count, const float matrix[20])
+{
+    V columns[5];
+    for (int j = 0; j < 5; ++j) {
+        columns[j] = V::Set(matrix[j], matrix[5 + j], matrix[10 + j], matrix[15 + j]);
+    }
+    const V zero = V::Splat(0.0f);
+    const V one = V::Splat(1.0f);
+    const V toByte = V::Splat(255.0f);
+    for (int32_t i = 0; i < count; ++i, in += 4, out += 4) {
+        const float unpremultiply = in[3] != 0 ? 1.0f / in[3] : 0.0f;
+        V result = columns[4] + columns[0] * V::Splat(in[0] * unpremultiply) +
+                   columns[1] * V::Splat(in[1] * unpremultiply) + columns[2] * V::Splat(in[2] * unpremultiply) +
+                   columns[3] * V::Splat(in[3] * FILTER_INV_255);
+        result = V::Min(V::Max(result, zero), one);
+        const float alpha = result.Alpha();
+        (result * V::Set(alpha, alpha, alpha, 1.0f) * toByte).StoreBytes(out);
+    }
+}
+
+template <typename V>
+void CompositeT(const uint8_t* a, const uint8_t* b, uint8_t* out, int32_t count, SvgFeOperatorType op,
+                const float k[4])
+{
+    const V toUnit = V::Splat(FILTER_INV_255);
+    const V toByte = V::Splat(255.0f);
+    const V zero = V::Splat(0.0f);
+    const V one = V::Splat(1.0f);
+    const V k1 = V::Splat(k[0]);
+    const V k2 = V::Splat(k[1]);
+    const V k3 = V::Splat(k[2]);
+    const V k4 = V::Splat(k[3]);
+    for (int32_t i = 0; i < count; ++i, a += 4, b += 4, out += 4) {
+        const V ca = V::LoadBytes(a) * toUnit;
+        const V cb = V::LoadBytes(b) * toUnit;
+        const V keepA = V::Splat(1.0f - a[3] * FILTER_INV_255);
+        const V keepB = V::Splat(1.0f - b[3] * FILTER_INV_255);
+        V result = zero;
+        switch (op) {
+            case SvgFeOperatorType::FE_OVER:
+                result = ca + cb * keepA;
+                break;
+            case SvgFeOperatorType::FE_IN:
+                result = ca * V::Splat(b[3] * FILTER_INV_255);
+                break;
+            case SvgFeOperatorType::FE_OUT:
+                result = ca * keepB;
+                break;
+            case SvgFeOperatorType::FE_ATOP:
+                result = ca * V::Splat(b[3] * FILTER_INV_255) + cb * keepA;
+                break;
+            case SvgFeOperatorType::FE_XOR:
+                result = ca * keepB + cb * keepA;
+                break;
+            case SvgFeOperatorType::FE_LIGHTER:
+                result = ca + cb;
+                break;
+            case SvgFeOperatorType::FE_ARITHMETIC:
+                result = k1 * ca * cb + k2 * ca + k3 * cb + k4;
+                break;
+        }
+        result = V::Min(V::Max(result, zero), one);
+        // arithmetic can leave color above alpha, which is not a valid
+        // premultiplied pixel
+        result = V::Min(result, V::Splat(result.Alpha()));
+        (result * toByte).StoreBytes(out);
+    }
+}
+
+// The blend formulas on premultiplied colors give 1 - (1 - qa)(1 - qb) when
+// applied to alpha as well, so all four lanes share them.
+template <typename V>
+void BlendT(const uint8_t* a, const uint8_t* b, uint8_t* out, int32_t count, SvgFeBlendMode mode)
+{
+    const V toUnit = V::Splat(FILTER_INV_255);
+    const V toByte = V::Splat(255.0f);
+    for (int32_t i = 0; i < count; ++i, a += 4, b += 4, out += 4) {
+        const V ca = V::LoadBytes(a) * toUnit;
+        const V cb = V::LoadBytes(b) * toUnit;
+        const V keepA = V::Splat(1.0f - a[3] * FILTER_INV_255);
+        const V keepB = V::Splat(1.0f - b[3] * FILTER_INV_255);
+        V result = ca;
+        switch (mode) {
+            case SvgFeBlendMode::NORMAL:
+                result = keepA * cb + ca;
+                break;
+            case SvgFeBlendMode::MULTIPLY:
+                result = keepA * cb + keepB * ca + ca * cb;
+                break;
+            case SvgFeBlendMode::SCREEN:
+                result = cb + ca - ca * cb;
+                break;
+            case SvgFeBlendMode::DARKEN:
+                result = V::Min(keepA * cb + ca, keepB * ca + cb);
+                break;
+            case SvgFeBlendMode::LIGHTEN:
+                result = V::Max(keepA * cb + ca, keepB * ca + cb);
+                break;
+        }
+        (result * toByte).StoreBytes(out);
+    }
+}
+
+// V runs the per pixel kernels, Wide the row sums of the vertical blur.
+template <typename V, typename Wide = V>
+FilterKernelTable MakeFilterKernelTable(const char* name)
+{
+    return {name, BoxLineT<V>, BoxRowsT<Wide, V>, ColorMatrixT<V>, CompositeT<V>, BlendT<V>};
+}
+} // namespace
+} // namespace rnoh
@@ -0,0 +1,131 @@
+#include "FontCache.h"
+#include <native_drawing/drawing_font.h>
+#include <native_drawing/drawing_font_mgr.h>
+#include <cmath>
+#include "Utils.h"
+
+namespace rnoh {
+namespace {
+constexpr float BUCKETS_PER_OCTAVE = 4.0f;
+
+void DestroyTypeface(OH_Drawing_Typeface* typeface)
+{
+    OH_Drawing_TypefaceDestroy(typeface);
+}
+
+void DestroyPath(const OH_Drawing_Path* path)
+{
+    OH_Drawing_PathDestroy(const_cast<OH_Drawing_Path*>(path));
+}
+} // namespace
+
+FontCache& FontCache::GetInstance()
+{
+    static FontCache cache;
+    return cache;
+}
+
+size_t FontCache::TypefaceKeyHash::operator()(const TypefaceKey& key) const
+{
+    size_t seed = std::hash<std::string>{}(key.family);
+    HashCombine(seed, key.weight);
+    HashCombine(seed, key.width);
+    HashCombine(seed, key.italic);
+    return seed;
+}
+
+size_t FontCache::GlyphKeyHash::operator()(const GlyphKey& key) const
+{
+    size_t seed = std::hash<const void*>{}(key.typeface);
+    HashCombine(seed, key.glyph);
+    HashCombine(seed, key.size);
+    return seed;
+}
+
+std::shared_ptr<OH_Drawing_Typeface> FontCache::GetTypeface(const TypefaceKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = typefaces_.find(key);
+    if (it != typefaces_.end()) {
+        ++typefaceHits_;
+        return it->second;
+    }
+    ++typefaceMisses_;
+    OH_Drawing_Typeface* typeface = nullptr;
+    if (!key.family.empty() || key.weight != 400 || key.width != 5 || key.italic) {
+        auto* fontMgr = OH_Drawing_FontMgrCreate();
+        OH_Drawing_FontStyleStruct style{key.weight, key.width,
+                                         key.italic ? FONT_STYLE_SLANT_ITALIC : FONT_STYLE_SLANT_UPRIGHT};
+        typeface = OH_Drawing_FontMgrMatchFamilyStyle(fontMgr, key.family.c_str(), style);
+        OH_Drawing_FontMgrDestroy(fontMgr);
+    }
+    if (!typeface) {
+        typeface = OH_Drawing_TypefaceCreateDefault();
+    }
+    std::shared_ptr<OH_Drawing_Typeface> shared(typeface, DestroyTypeface);
+    typefaces_.emplace(key, shared);
+    return shared;
+}
+
+float FontCache::GetSizeBucket(float size)
+{
+    if (!(size > 0.0f)) {
+        return 1.0f;
+    }
+    return std::exp2(std::round(std::log2(size) * BUCKETS_PER_OCTAVE) / BUCKETS_PER_OCTAVE);
+}
+
+std::shared_ptr<const OH_Drawing_Path> FontCache::GetGlyphPath(const std::shared_ptr<OH_Drawing_Typeface>& typeface,
+                                                               uint16_t glyph, float size)
+{
+    const GlyphKey key{typeface.get(), glyph, GetSizeBucket(size)};
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = glyphIndex_.find(key);
+    if (it != glyphIndex_.end()) {
+        ++glyphHits_;
+        glyphs_.splice(glyphs_.begin(), glyphs_, it->second);
+        return it->second->path;
+    }
+    ++glyphMisses_;
+    auto* font = OH_Drawing_FontCreate();
+    OH_Drawing_FontSetTypeface(font, typeface.get());
+    OH_Drawing_FontSetTextSize(font, key.size);
+    auto* path = OH_Drawing_PathCreate();
+    OH_Drawing_FontGetPathForGlyph(font, glyph, path);
+    OH_Drawing_FontDestroy(font);
+    std::shared_ptr<const OH_Drawing_Path> shared(path, DestroyPath);
+    glyphs_.push_front({key, shared, typeface});
+    glyphIndex_[key] = glyphs_.begin();
+    Trim();
+    return shared;
+}
+
+void FontCache::SetGlyphBudget(size_t glyphs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    glyphBudget_ = glyphs;
+    Trim();
+}
+
+FontCacheStats FontCache::GetStats() const
+{
+    return {typefaceHits_.load(), typefaceMisses_.load(), glyphHits_.load(), glyphMisses_.load()};
+}
+
+void FontCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    glyphIndex_.clear();
+    glyphs_.clear();
+    typefaces_.clear();
+}
+
+void FontCache::Trim()
+{
+    while (glyphs_.size() > glyphBudget_) {
+        glyphIndex_.erase(glyphs_.back().key);
+        glyphs_.pop_back();
+    }
+}
+
+} // namespace rnoh
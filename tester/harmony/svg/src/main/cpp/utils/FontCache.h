@@ -0,0 +1,101 @@
+#pragma once
+#include <native_drawing/drawing_path.h>
+#include <native_drawing/drawing_typeface.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rnoh {
+
+// Font selection of RNSVG's font props, width is the 1-9 font-stretch scale.
+struct TypefaceKey {
+    std::string family;
+    int weight = 400;
+    int width = 5;
+    bool italic = false;
+
+    bool operator==(const TypefaceKey& other) const
+    {
+        return family == other.family && weight == other.weight && width == other.width && italic == other.italic;
+    }
+};
+
+struct FontCacheStats {
+    uint64_t typefaceHits = 0;
+    uint64_t typefaceMisses = 0;
+    uint64_t glyphHits = 0;
+    uint64_t glyphMisses = 0;
+};
+
+// Process wide typefaces and glyph outlines shared by every SVG document.
+// Typefaces are matched once per key and kept for the process lifetime, as
+// apps use a handful. Outlines are kept in an LRU bounded by a glyph count.
+class FontCache {
+public:
+    static constexpr size_t DEFAULT_GLYPH_BUDGET = 4096;
+
+    static FontCache& GetInstance();
+
+    // Never null, the default typeface when nothing matches.
+    std::shared_ptr<OH_Drawing_Typeface> GetTypeface(const TypefaceKey& key);
+
+    // Outline of glyph drawn at GetSizeBucket(size) px, scale it by
+    // size / GetSizeBucket(size). Empty paths are cached too.
+    std::shared_ptr<const OH_Drawing_Path> GetGlyphPath(const std::shared_ptr<OH_Drawing_Typeface>& typeface,
+                                                        uint16_t glyph, float size);
+    // Quarter octave steps, close enough that scaled outlines keep their
+    // hinting yet few enough for labels animating their size to hit.
+    static float GetSizeBucket(float size);
+
+    void SetGlyphBudget(size_t glyphs);
+    FontCacheStats GetStats() const;
+    void Clear();
+
+private:
+    FontCache() = default;
+
+    struct TypefaceKeyHash {
+        size_t operator()(const TypefaceKey& key) const;
+    };
+    struct GlyphKey {
+        const OH_Drawing_Typeface* typeface;
+        uint16_t glyph;
+        float size;
+
+        bool operator==(const GlyphKey& other) const
+        {
+            return typeface == other.typeface && glyph == other.glyph && size == other.size;
+        }
+    };
+    struct GlyphKeyHash {
+        size_t operator()(const GlyphKey& key) const;
+    };
+    struct GlyphEntry {
+        GlyphKey key;
+        std::shared_ptr<const OH_Drawing_Path> path;
+        // keeps the typeface the key points to alive
+        std::shared_ptr<OH_Drawing_Typeface> typeface;
+    };
+
+    // evicts least recently used outlines until the budget holds, mutex_ held
+    void Trim();
+
+    mutable std::mutex mutex_;
+    std::unordered_map<TypefaceKey, std::shared_ptr<OH_Drawing_Typeface>, TypefaceKeyHash> typefaces_;
+    // most recently used first
+    std::list<GlyphEntry> glyphs_;
+    std::unordered_map<GlyphKey, std::list<GlyphEntry>::iterator, GlyphKeyHash> glyphIndex_;
+    size_t glyphBudget_ = DEFAULT_GLYPH_BUDGET;
+
+    std::atomic<uint64_t> typefaceHits_{0};
+    std::atomic<uint64_t> typefaceMisses_{0};
+    std::atomic<uint64_t> glyphHits_{0};
+    std::atomic<uint64_t> glyphMisses_{0};
+};
+
+} // namespace rnoh
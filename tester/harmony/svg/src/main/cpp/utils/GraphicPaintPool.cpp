@@ -0,0 +1,43 @@
+#include "GraphicPaintPool.h"
+
+namespace rnoh {
+
+GraphicPaintPool& GraphicPaintPool::GetInstance()
+{
+    // never destroyed, shapes can outlive static destruction
+    static auto* instance = new GraphicPaintPool();
+    return *instance;
+}
+
+GraphicPaints GraphicPaintPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pooled_.empty()) {
+            auto paints = pooled_.back();
+            pooled_.pop_back();
+            return paints;
+        }
+    }
+    return {OH_Drawing_BrushCreate(), OH_Drawing_PenCreate(), OH_Drawing_PathCreate()};
+}
+
+void GraphicPaintPool::Release(const GraphicPaints& paints)
+{
+    // reset outside the lock, shapes are destroyed on the main and worker threads
+    OH_Drawing_BrushReset(paints.brush);
+    OH_Drawing_PenReset(paints.pen);
+    OH_Drawing_PathReset(paints.path);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pooled_.size() < MAX_POOLED) {
+            pooled_.push_back(paints);
+            return;
+        }
+    }
+    OH_Drawing_BrushDestroy(paints.brush);
+    OH_Drawing_PenDestroy(paints.pen);
+    OH_Drawing_PathDestroy(paints.path);
+}
+
+} // namespace rnoh
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <native_drawing/drawing_brush.h>
+#include <native_drawing/drawing_path.h>
+#include <native_drawing/drawing_pen.h>
+
+namespace rnoh {
+
+// The native objects every shape owns.
+struct GraphicPaints {
+    OH_Drawing_Brush* brush = nullptr;
+    OH_Drawing_Pen* pen = nullptr;
+    OH_Drawing_Path* path = nullptr;
+};
+
+// Recycles the paints of destroyed shapes. Lists that mount and unmount rows
+// while scrolling otherwise create and destroy three native objects per
+// shape each time; released paints are reset and handed to the next shape.
+class GraphicPaintPool {
+public:
+    static GraphicPaintPool& GetInstance();
+
+    // Reset paints, pooled ones first.
+    GraphicPaints Acquire();
+    // paints must not be used afterwards, they are destroyed if the pool is full
+    void Release(const GraphicPaints& paints);
+
+private:
+    // enough for a screenful of list rows
+    static constexpr size_t MAX_POOLED = 256;
+
+    GraphicPaintPool() = default;
+
+    std::mutex mutex_;
+    std::vector<GraphicPaints> pooled_;
+};
+
+} // namespace rnoh
@@ -0,0 +1,262 @@
+#include "ImageCache.h"
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "Utils.h"
+#include "WorkerPool.h"
+
+namespace rnoh {
+namespace {
+constexpr char DATA_URI_PREFIX[] = "data:";
+constexpr char FILE_URI_PREFIX[] = "file://";
+
+bool HasPrefix(const std::string& text, const char* prefix)
+{
+    return text.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+// schemes CreateSource cannot open, skipped without a decode
+bool IsUnsupported(const std::string& href)
+{
+    return HasPrefix(href, "http://") || HasPrefix(href, "https://") || HasPrefix(href, "asset://") ||
+           HasPrefix(href, "resource://");
+}
+
+std::vector<uint8_t> DecodeBase64(const std::string& text, size_t begin)
+{
+    std::vector<uint8_t> bytes;
+    bytes.reserve((text.size() - begin) * 3 / 4);
+    uint32_t buffer = 0;
+    int bits = 0;
+    for (size_t i = begin; i < text.size(); ++i) {
+        const char c = text[i];
+        int value = -1;
+        if (c >= 'A' && c <= 'Z') {
+            value = c - 'A';
+        } else if (c >= 'a' && c <= 'z') {
+            value = c - 'a' + 26;
+        } else if (c >= '0' && c <= '9') {
+            value = c - '0' + 52;
+        } else if (c == '+' || c == '-') {
+            value = 62;
+        } else if (c == '/' || c == '_') {
+            value = 63;
+        } else if (c == '=') {
+            break;
+        }
+        if (value < 0) {
+            continue;
+        }
+        buffer = (buffer << 6) | static_cast<uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            bytes.push_back(static_cast<uint8_t>(buffer >> bits));
+        }
+    }
+    return bytes;
+}
+
+OH_ImageSourceNative* CreateSource(const std::string& href)
+{
+    OH_ImageSourceNative* source = nullptr;
+    if (HasPrefix(href, DATA_URI_PREFIX)) {
+        const size_t comma = href.find(',');
+        if (comma == std::string::npos || href.rfind(";base64", comma) == std::string::npos) {
+            return nullptr;
+        }
+        auto bytes = DecodeBase64(href, comma + 1);
+        OH_ImageSourceNative_CreateFromData(bytes.data(), bytes.size(), &source);
+        return source;
+    }
+    std::string uri = href.front() == '/' ? FILE_URI_PREFIX + href : href;
+    OH_ImageSourceNative_CreateFromUri(uri.data(), uri.size(), &source);
+    return source;
+}
+
+// Size the source is decoded at to fill the key's box, never above the
+// source's own size.
+Image_Size GetDecodeSize(uint32_t sourceWidth, uint32_t sourceHeight, const ImageCacheKey& key)
+{
+    double scaleX = static_cast<double>(key.width) / sourceWidth;
+    double scaleY = static_cast<double>(key.height) / sourceHeight;
+    if (key.fit == MeetOrSlice::MEET) {
+        scaleX = scaleY = std::min(scaleX, scaleY);
+    } else if (key.fit == MeetOrSlice::SLICE) {
+        scaleX = scaleY = std::max(scaleX, scaleY);
+    }
+    auto length = [](uint32_t source, double scale) {
+        return std::clamp(static_cast<uint32_t>(std::ceil(source * std::min(scale, 1.0))), 1u, source);
+    };
+    return {length(sourceWidth, scaleX), length(sourceHeight, scaleY)};
+}
+
+std::shared_ptr<DecodedImage> Decode(const ImageCacheKey& key)
+{
+    auto* source = CreateSource(key.href);
+    if (!source) {
+        return nullptr;
+    }
+    uint32_t width = 0;
+    uint32_t height = 0;
+    OH_ImageSource_Info* info = nullptr;
+    OH_ImageSourceInfo_Create(&info);
+    if (OH_ImageSourceNative_GetImageInfo(source, 0, info) == IMAGE_SUCCESS) {
+        OH_ImageSourceInfo_GetWidth(info, &width);
+        OH_ImageSourceInfo_GetHeight(info, &height);
+    }
+    OH_ImageSourceInfo_Release(info);
+    OH_PixelmapNative* pixelmap = nullptr;
+    Image_Size size{0, 0};
+    if (width > 0 && height > 0) {
+        size = GetDecodeSize(width, height, key);
+        OH_DecodingOptions* options = nullptr;
+        OH_DecodingOptions_Create(&options);
+        OH_DecodingOptions_SetDesiredSize(options, &size);
+        OH_ImageSourceNative_CreatePixelmap(source, options, &pixelmap);
+        OH_DecodingOptions_Release(options);
+    }
+    OH_ImageSourceNative_Release(source);
+    if (!pixelmap) {
+        LOG(WARNING) << "[ImageCache] cannot decode " << key.href.substr(0, 64);
+        return nullptr;
+    }
+    return std::make_shared<DecodedImage>(pixelmap, size.width, size.height);
+}
+} // namespace
+
+DecodedImage::DecodedImage(OH_PixelmapNative* pixelmap, uint32_t width, uint32_t height)
+    : pixelmap_(pixelmap), pixelMap_(OH_Drawing_PixelMapGetFromOhPixelMapNative(pixelmap)), width_(width),
+      height_(height)
+{
+}
+
+DecodedImage::~DecodedImage()
+{
+    OH_Drawing_PixelMapDissolve(pixelMap_);
+    OH_PixelmapNative_Release(pixelmap_);
+}
+
+ImageCache& ImageCache::GetInstance()
+{
+    static ImageCache cache;
+    return cache;
+}
+
+size_t ImageCache::KeyHash::operator()(const ImageCacheKey& key) const
+{
+    size_t seed = std::hash<std::string>{}(key.href);
+    HashCombine(seed, key.width);
+    HashCombine(seed, key.height);
+    HashCombine(seed, static_cast<int>(key.fit));
+    return seed;
+}
+
+std::shared_ptr<DecodedImage> ImageCache::Request(const ImageCacheKey& key, bool& pending)
+{
+    pending = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->second;
+        }
+        auto uncached = uncached_.find(key);
+        if (uncached != uncached_.end()) {
+            if (uncached->second.unclaimed) {
+                return std::move(uncached->second.unclaimed);
+            }
+            if (auto image = uncached->second.image.lock()) {
+                return image;
+            }
+            uncached_.erase(uncached);
+        }
+        if (key.href.empty() || key.width == 0 || key.height == 0) {
+            return nullptr;
+        }
+        auto failed = failed_.find(key);
+        if (failed != failed_.end()) {
+            if (GetNanoseconds() - failed->second < FAILURE_RETRY_NS) {
+                return nullptr;
+            }
+            failed_.erase(failed);
+        }
+        if (IsUnsupported(key.href)) {
+            LOG(WARNING) << "[ImageCache] unsupported source " << key.href.substr(0, 64);
+            failed_[key] = GetNanoseconds();
+            return nullptr;
+        }
+        pending = true;
+        if (!pending_.insert(key).second) {
+            return nullptr;
+        }
+    }
+    WorkerPool::GetInstance().Post([this, key] { Finish(key, Decode(key)); });
+    return nullptr;
+}
+
+void ImageCache::Finish(const ImageCacheKey& key, std::shared_ptr<DecodedImage> image)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.erase(key);
+        if (!image) {
+            failed_[key] = GetNanoseconds();
+        } else if (image->GetBytes() > budget_) {
+            // could never be kept, drawn by whoever holds it
+            for (auto it = uncached_.begin(); it != uncached_.end();) {
+                it = it->second.image.expired() ? uncached_.erase(it) : std::next(it);
+            }
+            Uncached& uncached = uncached_[key];
+            uncached.image = image;
+            uncached.unclaimed = std::move(image);
+        } else {
+            entries_.emplace_front(key, std::move(image));
+            index_[key] = entries_.begin();
+            bytes_ += entries_.front().second->GetBytes();
+            Trim();
+        }
+    }
+    ++epoch_;
+}
+
+void ImageCache::Retry(const std::string& href)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = failed_.begin(); it != failed_.end();) {
+        it = it->first.href == href ? failed_.erase(it) : std::next(it);
+    }
+}
+
+void ImageCache::SetBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = bytes;
+    Trim();
+}
+
+void ImageCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    failed_.clear();
+    uncached_.clear();
+    bytes_ = 0;
+}
+
+void ImageCache::Trim()
+{
+    while (bytes_ > budget_ && !entries_.empty()) {
+        const auto& last = entries_.back();
+        bytes_ -= last.second->GetBytes();
+        index_.erase(last.first);
+        entries_.pop_back();
+    }
+}
+
+} // namespace rnoh
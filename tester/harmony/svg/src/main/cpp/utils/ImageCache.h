@@ -0,0 +1,124 @@
+#pragma once
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <native_drawing/drawing_pixel_map.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "ViewBox.h"
+
+namespace rnoh {
+
+// A source decoded for one box: href drawn into width x height device pixels
+// with the fit of preserveAspectRatio. Sources are decoded no larger than
+// they are drawn, so the same href yields one entry per displayed size.
+struct ImageCacheKey {
+    std::string href;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    MeetOrSlice fit = MeetOrSlice::MEET;
+
+    bool operator==(const ImageCacheKey& other) const
+    {
+        return href == other.href && width == other.width && height == other.height && fit == other.fit;
+    }
+};
+
+// Owns a decoded pixel map and the drawing handle onto it.
+class DecodedImage {
+public:
+    DecodedImage(OH_PixelmapNative* pixelmap, uint32_t width, uint32_t height);
+    ~DecodedImage();
+
+    DecodedImage(const DecodedImage&) = delete;
+    DecodedImage& operator=(const DecodedImage&) = delete;
+
+    OH_Drawing_PixelMap* Get() const
+    {
+        return pixelMap_;
+    }
+    uint32_t Width() const
+    {
+        return width_;
+    }
+    uint32_t Height() const
+    {
+        return height_;
+    }
+    size_t GetBytes() const
+    {
+        return static_cast<size_t>(width_) * height_ * 4;
+    }
+
+private:
+    OH_PixelmapNative* pixelmap_;
+    OH_Drawing_PixelMap* pixelMap_;
+    uint32_t width_;
+    uint32_t height_;
+};
+
+// Process wide LRU of decoded images bounded by a byte budget, shared by
+// every document. Decoding happens on the worker pool; local files and data
+// URIs are supported. http(s) URLs and bundled assets are not loaded, they
+// need a fetcher and the resource manager, which this layer has no access to.
+class ImageCache {
+public:
+    static constexpr size_t DEFAULT_BUDGET = 32 * 1024 * 1024;
+    static constexpr uint64_t FAILURE_RETRY_NS = 10'000'000'000;
+
+    static ImageCache& GetInstance();
+
+    // The decoded image, nullptr while it decodes or when decoding failed.
+    // The first request for a key starts its decode; pending tells whether
+    // the image may still arrive. An image over the whole budget is not
+    // kept: it is handed to the first request after its decode and lives as
+    // long as a caller holds it.
+    std::shared_ptr<DecodedImage> Request(const ImageCacheKey& key, bool& pending);
+    // Lets failed decodes of href run again, called when a node switches to
+    // it. Failures are otherwise retried once FAILURE_RETRY_NS passed.
+    void Retry(const std::string& href);
+    // Bumped whenever a decode finishes, frames drawn while images were
+    // missing are redrawn once it moves.
+    uint64_t GetEpoch() const
+    {
+        return epoch_.load();
+    }
+    void SetBudget(size_t bytes);
+    void Clear();
+
+private:
+    ImageCache() = default;
+
+    struct KeyHash {
+        size_t operator()(const ImageCacheKey& key) const;
+    };
+    using Entry = std::pair<ImageCacheKey, std::shared_ptr<DecodedImage>>;
+
+    void Finish(const ImageCacheKey& key, std::shared_ptr<DecodedImage> image);
+    // evicts least recently used entries until the budget holds, mutex_ held
+    void Trim();
+
+    std::mutex mutex_;
+    // most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<ImageCacheKey, std::list<Entry>::iterator, KeyHash> index_;
+    std::unordered_set<ImageCacheKey, KeyHash> pending_;
+    // time of the failed decode
+    std::unordered_map<ImageCacheKey, uint64_t, KeyHash> failed_;
+    // images over the budget, held here only until the first request
+    struct Uncached {
+        std::shared_ptr<DecodedImage> unclaimed;
+        std::weak_ptr<DecodedImage> image;
+    };
+    std::unordered_map<ImageCacheKey, Uncached, KeyHash> uncached_;
+    size_t bytes_ = 0;
+    size_t budget_ = DEFAULT_BUDGET;
+    std::atomic<uint64_t> epoch_{0};
+};
+
+} // namespace rnoh
@@ -0,0 +1,606 @@
+#include "ImageEncoder.h"
+#include <zlib.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace rnoh {
+
+namespace {
+const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void AppendBase64Group(std::string& out, const uint8_t* data, size_t size)
+{
+    const uint32_t group = (data[0] << 16) | (size > 1 ? data[1] << 8 : 0) | (size > 2 ? data[2] : 0);
+    out.push_back(BASE64_CHARS[(group >> 18) & 0x3f]);
+    out.push_back(BASE64_CHARS[(group >> 12) & 0x3f]);
+    out.push_back(size > 1 ? BASE64_CHARS[(group >> 6) & 0x3f] : '=');
+    out.push_back(size > 2 ? BASE64_CHARS[group & 0x3f] : '=');
+}
+
+// 255 / alpha in 16.16 fixed point, for straight alpha output
+const uint32_t* GetUnpremultiplyTable()
+{
+    static const auto table = [] {
+        std::vector<uint32_t> values(256, 0);
+        for (uint32_t alpha = 1; alpha < 256; ++alpha) {
+            values[alpha] = (255u << 16) / alpha;
+        }
+        return values;
+    }();
+    return table.data();
+}
+
+void PutBigEndian32(uint8_t* out, uint32_t value)
+{
+    out[0] = static_cast<uint8_t>(value >> 24);
+    out[1] = static_cast<uint8_t>(value >> 16);
+    out[2] = static_cast<uint8_t>(value >> 8);
+    out[3] = static_cast<uint8_t>(value);
+}
+
+class PngEncoder : public ImageEncoder {
+public:
+    PngEncoder(ByteSink& sink, uint32_t width, uint32_t height)
+        : sink_(sink), width_(width), height_(height), rowBytes_(static_cast<size_t>(width) * 4),
+          previous_(rowBytes_, 0), current_(rowBytes_), candidate_(rowBytes_ + 1), best_(rowBytes_ + 1),
+          compressed_(OUTPUT_CHUNK)
+    {
+        ok_ = deflateInit(&stream_, Z_DEFAULT_COMPRESSION) == Z_OK;
+        static const uint8_t SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        sink_.Write(SIGNATURE, sizeof(SIGNATURE));
+        uint8_t header[13];
+        PutBigEndian32(header, width_);
+        PutBigEndian32(header + 4, height_);
+        header[8] = 8; // bit depth
+        header[9] = 6; // RGBA
+        header[10] = 0;
+        header[11] = 0;
+        header[12] = 0;
+        WriteChunk("IHDR", header, sizeof(header));
+        stream_.next_out = compressed_.data();
+        stream_.avail_out = OUTPUT_CHUNK;
+    }
+
+    ~PngEncoder() override
+    {
+        if (ok_) {
+            deflateEnd(&stream_);
+        }
+    }
+
+    bool WriteRows(const uint8_t* pixels, size_t stride, uint32_t rows) override
+    {
+        const auto* unpremultiply = GetUnpremultiplyTable();
+        for (uint32_t row = 0; ok_ && row < rows && rowsWritten_ < height_; ++row, ++rowsWritten_) {
+            const uint8_t* source = pixels + row * stride;
+            for (size_t i = 0; i < rowBytes_; i += 4) {
+                const uint32_t scale = unpremultiply[source[i + 3]];
+                current_[i] = static_cast<uint8_t>(std::min((source[i] * scale + 0x8000) >> 16, 255u));
+                current_[i + 1] = static_cast<uint8_t>(std::min((source[i + 1] * scale + 0x8000) >> 16, 255u));
+                current_[i + 2] = static_cast<uint8_t>(std::min((source[i + 2] * scale + 0x8000) >> 16, 255u));
+                current_[i + 3] = source[i + 3];
+            }
+            FilterRow();
+            Deflate(best_.data(), best_.size(), Z_NO_FLUSH);
+            previous_.swap(current_);
+        }
+        return ok_;
+    }
+
+    bool Finish() override
+    {
+        if (!ok_ || rowsWritten_ != height_) {
+            return false;
+        }
+        Deflate(nullptr, 0, Z_FINISH);
+        FlushIdat();
+        WriteChunk("IEND", nullptr, 0);
+        return ok_;
+    }
+
+private:
+    static constexpr uInt OUTPUT_CHUNK = 64 * 1024;
+
+    static uint8_t Paeth(int left, int up, int upLeft)
+    {
+        const int estimate = left + up - upLeft;
+        const int toLeft = std::abs(estimate - left);
+        const int toUp = std::abs(estimate - up);
+        const int toUpLeft = std::abs(estimate - upLeft);
+        if (toLeft <= toUp && toLeft <= toUpLeft) {
+            return static_cast<uint8_t>(left);
+        }
+        return static_cast<uint8_t>(toUp <= toUpLeft ? up : upLeft);
+    }
+
+    // Picks the filter with the smallest sum of absolute residuals, the
+    // heuristic libpng uses, into best_.
+    void FilterRow()
+    {
+        uint64_t bestCost = UINT64_MAX;
+        for (uint8_t filter = 0; filter < 5; ++filter) {
+            uint8_t* out = candidate_.data();
+            out[0] = filter;
+            uint64_t cost = 0;
+            for (size_t i = 0; i < rowBytes_; ++i) {
+                const int left = i >= 4 ? current_[i - 4] : 0;
+                const int up = previous_[i];
+                const int upLeft = i >= 4 ? previous_[i - 4] : 0;
+                int predicted = 0;
+                switch (filter) {
+                    case 1:
+                        predicted = left;
+                        break;
+                    case 2:
+                        predicted = up;
+                        break;
+                    case 3:
+                        predicted = (left + up) >> 1;
+                        break;
+                    case 4:
+                        predicted = Paeth(left, up, upLeft);
+                        break;
+                    default:
+                        break;
+                }
+                const auto residual = static_cast<uint8_t>(current_[i] - predicted);
+                out[i + 1] = residual;
+                cost += residual < 128 ? residual : 256 - residual;
+            }
+            if (cost < bestCost) {
+                bestCost = cost;
+                best_.swap(candidate_);
+            }
+        }
+    }
+
+    void Deflate(const uint8_t* data, size_t size, int flush)
+    {
+        stream_.next_in = const_cast<Bytef*>(data);
+        stream_.avail_in = static_cast<uInt>(size);
+        while (ok_) {
+            const int result = deflate(&stream_, flush);
+            if (result == Z_STREAM_ERROR) {
+                ok_ = false;
+                return;
+            }
+            if (stream_.avail_out == 0) {
+                FlushIdat();
+                continue;
+            }
+            if (flush == Z_FINISH ? result == Z_STREAM_END : stream_.avail_in == 0) {
+                return;
+            }
+        }
+    }
+
+    // one IDAT per filled output buffer, the stream is never held whole
+    void FlushIdat()
+    {
+        const size_t size = OUTPUT_CHUNK - stream_.avail_out;
+        if (size > 0) {
+            WriteChunk("IDAT", compressed_.data(), size);
+        }
+        stream_.next_out = compressed_.data();
+        stream_.avail_out = OUTPUT_CHUNK;
+    }
+
+    void WriteChunk(const char* type, const uint8_t* data, size_t size)
+    {
+        uint8_t header[8];
+        PutBigEndian32(header, static_cast<uint32_t>(size));
+        std::memcpy(header + 4, type, 4);
+        sink_.Write(header, sizeof(header));
+        uLong crc = crc32(0, header + 4, 4);
+        if (size > 0) {
+            sink_.Write(data, size);
+            crc = crc32(crc, data, static_cast<uInt>(size));
+        }
+        uint8_t trailer[4];
+        PutBigEndian32(trailer, static_cast<uint32_t>(crc));
+        sink_.Write(trailer, sizeof(trailer));
+    }
+
+    ByteSink& sink_;
+    uint32_t width_;
+    uint32_t height_;
+    size_t rowBytes_;
+    uint32_t rowsWritten_ = 0;
+    std::vector<uint8_t> previous_;
+    std::vector<uint8_t> current_;
+    // filter type byte followed by the filtered row
+    std::vector<uint8_t> candidate_;
+    std::vector<uint8_t> best_;
+    std::vector<uint8_t> compressed_;
+    z_stream stream_{};
+    bool ok_ = false;
+};
+
+// ITU T.81 Annex K tables
+const uint8_t ZIGZAG[64] = {0,  1,  5,  6,  14, 15, 27, 28, 2,  4,  7,  13, 16, 26, 29, 42,
+                            3,  8,  12, 17, 25, 30, 41, 43, 9,  11, 18, 24, 31, 40, 44, 53,
+                            10, 19, 23, 32, 39, 45, 52, 54, 20, 22, 33, 38, 46, 51, 55, 60,
+                            21, 34, 37, 47, 50, 56, 59, 61, 35, 36, 48, 49, 57, 58, 62, 63};
+const uint8_t LUMA_QUANT[64] = {16, 11, 10, 16, 24,  40,  51,  61,  12, 12, 14, 19, 26,  58,  60,  55,
+                                14, 13, 16, 24, 40,  57,  69,  56,  14, 17, 22, 29, 51,  87,  80,  62,
+                                18, 22, 37, 56, 68,  109, 103, 77,  24, 35, 55, 64, 81,  104, 113, 92,
+                                49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99};
+const uint8_t CHROMA_QUANT[64] = {17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+                                  24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+                                  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                                  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99};
+const uint8_t DC_LUMA_BITS[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+const uint8_t DC_CHROMA_BITS[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+const uint8_t DC_VALUES[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+const uint8_t AC_LUMA_BITS[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+const uint8_t AC_LUMA_VALUES[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71,
+    0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3,
+    0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa};
+const uint8_t AC_CHROMA_BITS[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+const uint8_t AC_CHROMA_VALUES[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22,
+    0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1,
+    0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a,
+    0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba,
+    0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa};
+
+// canonical Huffman codes by symbol
+struct HuffmanTable {
+    uint16_t codes[256] = {};
+    uint8_t lengths[256] = {};
+
+    HuffmanTable(const uint8_t* bits, const uint8_t* values)
+    {
+        uint16_t code = 0;
+        size_t index = 0;
+        for (int length = 1; length <= 16; ++length) {
+            for (int i = 0; i < bits[length - 1]; ++i, ++index) {
+                codes[values[index]] = code++;
+                lengths[values[index]] = static_cast<uint8_t>(length);
+            }
+            code <<= 1;
+        }
+    }
+};
+
+// 8 point AAN forward DCT, its scale factors are folded into the divisors
+void ForwardDct(float* data, size_t step)
+{
+    float* d = data;
+    const float tmp0 = d[0] + d[7 * step];
+    const float tmp7 = d[0] - d[7 * step];
+    const float tmp1 = d[step] + d[6 * step];
+    const float tmp6 = d[step] - d[6 * step];
+    const float tmp2 = d[2 * step] + d[5 * step];
+    const float tmp5 = d[2 * step] - d[5 * step];
+    const float tmp3 = d[3 * step] + d[4 * step];
+    const float tmp4 = d[3 * step] - d[4 * step];
+
+    const float tmp10 = tmp0 + tmp3;
+    const float tmp13 = tmp0 - tmp3;
+    const float tmp11 = tmp1 + tmp2;
+    const float tmp12 = tmp1 - tmp2;
+    d[0] = tmp10 + tmp11;
+    d[4 * step] = tmp10 - tmp11;
+    const float z1 = (tmp12 + tmp13) * 0.707106781f;
+    d[2 * step] = tmp13 + z1;
+    d[6 * step] = tmp13 - z1;
+
+    const float odd10 = tmp4 + tmp5;
+    const float odd11 = tmp5 + tmp6;
+    const float odd12 = tmp6 + tmp7;
+    const float z5 = (odd10 - odd12) * 0.382683433f;
+    const float z2 = odd10 * 0.541196100f + z5;
+    const float z4 = odd12 * 1.306562965f + z5;
+    const float z3 = odd11 * 0.707106781f;
+    const float z11 = tmp7 + z3;
+    const float z13 = tmp7 - z3;
+    d[5 * step] = z13 + z2;
+    d[3 * step] = z13 - z2;
+    d[step] = z11 + z4;
+    d[7 * step] = z11 - z4;
+}
+
+class JpegEncoder : public ImageEncoder {
+public:
+    JpegEncoder(ByteSink& sink, uint32_t width, uint32_t height, double quality)
+        : sink_(sink), width_(width), height_(height), paddedWidth_((width + MCU - 1) / MCU * MCU),
+          strip_(static_cast<size_t>(paddedWidth_) * MCU * 3), dcLuma_(DC_LUMA_BITS, DC_VALUES),
+          dcChroma_(DC_CHROMA_BITS, DC_VALUES), acLuma_(AC_LUMA_BITS, AC_LUMA_VALUES),
+          acChroma_(AC_CHROMA_BITS, AC_CHROMA_VALUES)
+    {
+        // IJG quality scaling
+        const int percent = std::clamp(static_cast<int>(std::lround(quality * 100.0)), 1, 100);
+        const int scale = percent < 50 ? 5000 / percent : 200 - percent * 2;
+        static const float AAN_SCALES[8] = {1.0f,         1.387039845f, 1.306562965f, 1.175875602f,
+                                            1.0f,         0.785694958f, 0.541196100f, 0.275899379f};
+        for (int i = 0; i < 64; ++i) {
+            lumaQuant_[ZIGZAG[i]] = static_cast<uint8_t>(std::clamp((LUMA_QUANT[i] * scale + 50) / 100, 1, 255));
+            chromaQuant_[ZIGZAG[i]] =
+                static_cast<uint8_t>(std::clamp((CHROMA_QUANT[i] * scale + 50) / 100, 1, 255));
+        }
+        for (int row = 0, i = 0; row < 8; ++row) {
+            for (int col = 0; col < 8; ++col, ++i) {
+                const float aan = AAN_SCALES[row] * AAN_SCALES[col] * 8.0f;
+                lumaDivisors_[i] = 1.0f / (lumaQuant_[ZIGZAG[i]] * aan);
+                chromaDivisors_[i] = 1.0f / (chromaQuant_[ZIGZAG[i]] * aan);
+            }
+        }
+        WriteHeaders();
+    }
+
+    bool WriteRows(const uint8_t* pixels, size_t stride, uint32_t rows) override
+    {
+        for (uint32_t row = 0; row < rows && rowsWritten_ < height_; ++row, ++rowsWritten_) {
+            const uint8_t* source = pixels + row * stride;
+            uint8_t* out = &strip_[static_cast<size_t>(stripRows_) * paddedWidth_ * 3];
+            for (uint32_t x = 0; x < width_; ++x, source += 4, out += 3) {
+                // premultiplied over white
+                const uint8_t background = 255 - source[3];
+                out[0] = source[0] + background;
+                out[1] = source[1] + background;
+                out[2] = source[2] + background;
+            }
+            // replicate the last column into the padding
+            for (uint32_t x = width_; x < paddedWidth_; ++x, out += 3) {
+                std::memcpy(out, out - 3, 3);
+            }
+            if (++stripRows_ == MCU) {
+                EncodeStrip();
+            }
+        }
+        return true;
+    }
+
+    bool Finish() override
+    {
+        if (rowsWritten_ != height_) {
+            return false;
+        }
+        if (stripRows_ > 0) {
+            const size_t rowBytes = static_cast<size_t>(paddedWidth_) * 3;
+            for (uint32_t row = stripRows_; row < MCU; ++row) {
+                std::memcpy(&strip_[row * rowBytes], &strip_[(stripRows_ - 1) * rowBytes], rowBytes);
+            }
+            EncodeStrip();
+        }
+        // pad the last byte with ones
+        WriteBits(0x7f, 7);
+        const uint8_t end[] = {0xff, 0xd9};
+        Flush();
+        sink_.Write(end, sizeof(end));
+        return true;
+    }
+
+private:
+    static constexpr uint32_t MCU = 16;
+
+    void WriteHeaders()
+    {
+        std::vector<uint8_t> header = {0xff, 0xd8, 0xff, 0xe0, 0, 16, 'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0};
+        header.insert(header.end(), {0xff, 0xdb, 0, 132, 0});
+        header.insert(header.end(), lumaQuant_, lumaQuant_ + 64);
+        header.push_back(1);
+        header.insert(header.end(), chromaQuant_, chromaQuant_ + 64);
+        header.insert(header.end(), {0xff, 0xc0, 0, 17, 8, static_cast<uint8_t>(height_ >> 8),
+                                     static_cast<uint8_t>(height_), static_cast<uint8_t>(width_ >> 8),
+                                     static_cast<uint8_t>(width_), 3, 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1});
+        header.insert(header.end(), {0xff, 0xc4, 0x01, 0xa2});
+        auto appendTable = [&header](uint8_t id, const uint8_t* bits, const uint8_t* values, size_t count) {
+            header.push_back(id);
+            header.insert(header.end(), bits, bits + 16);
+            header.insert(header.end(), values, values + count);
+        };
+        appendTable(0x00, DC_LUMA_BITS, DC_VALUES, sizeof(DC_VALUES));
+        appendTable(0x10, AC_LUMA_BITS, AC_LUMA_VALUES, sizeof(AC_LUMA_VALUES));
+        appendTable(0x01, DC_CHROMA_BITS, DC_VALUES, sizeof(DC_VALUES));
+        appendTable(0x11, AC_CHROMA_BITS, AC_CHROMA_VALUES, sizeof(AC_CHROMA_VALUES));
+        header.insert(header.end(), {0xff, 0xda, 0, 12, 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 0x3f, 0});
+        sink_.Write(header.data(), header.size());
+    }
+
+    // one row of 16x16 MCUs: four luma blocks, then one Cb and one Cr block
+    // averaged over 2x2 pixels
+    void EncodeStrip()
+    {
+        const size_t rowBytes = static_cast<size_t>(paddedWidth_) * 3;
+        float y[256];
+        float cb[64];
+        float cr[64];
+        for (uint32_t x0 = 0; x0 < paddedWidth_; x0 += MCU) {
+            std::fill(cb, cb + 64, 0.0f);
+            std::fill(cr, cr + 64, 0.0f);
+            for (uint32_t row = 0; row < MCU; ++row) {
+                const uint8_t* pixel = &strip_[row * rowBytes + x0 * 3];
+                for (uint32_t col = 0; col < MCU; ++col, pixel += 3) {
+                    const float r = pixel[0];
+                    const float g = pixel[1];
+                    const float b = pixel[2];
+                    y[row * MCU + col] = 0.299f * r + 0.587f * g + 0.114f * b - 128.0f;
+                    const size_t chroma = (row >> 1) * 8 + (col >> 1);
+                    cb[chroma] += 0.25f * (-0.168736f * r - 0.331264f * g + 0.5f * b);
+                    cr[chroma] += 0.25f * (0.5f * r - 0.418688f * g - 0.081312f * b);
+                }
+            }
+            for (uint32_t block = 0; block < 4; ++block) {
+                float luma[64];
+                const float* origin = y + (block >> 1) * 8 * MCU + (block & 1) * 8;
+                for (int row = 0; row < 8; ++row) {
+                    std::memcpy(luma + row * 8, origin + row * MCU, 8 * sizeof(float));
+                }
+                EncodeBlock(luma, lumaDivisors_, dcLumaPrevious_, dcLuma_, acLuma_);
+            }
+            EncodeBlock(cb, chromaDivisors_, dcCbPrevious_, dcChroma_, acChroma_);
+            EncodeBlock(cr, chromaDivisors_, dcCrPrevious_, dcChroma_, acChroma_);
+        }
+        stripRows_ = 0;
+    }
+
+    void EncodeBlock(float* block, const float* divisors, int& dcPrevious, const HuffmanTable& dc,
+                     const HuffmanTable& ac)
+    {
+        for (int row = 0; row < 8; ++row) {
+            ForwardDct(block + row * 8, 1);
+        }
+        for (int col = 0; col < 8; ++col) {
+            ForwardDct(block + col, 8);
+        }
+        int coefficients[64];
+        for (int i = 0; i < 64; ++i) {
+            const float value = block[i] * divisors[i];
+            coefficients[ZIGZAG[i]] = static_cast<int>(value < 0.0f ? value - 0.5f : value + 0.5f);
+        }
+        const int diff = coefficients[0] - dcPrevious;
+        dcPrevious = coefficients[0];
+        const int dcSize = BitSize(diff);
+        WriteBits(dc.codes[dcSize], dc.lengths[dcSize]);
+        WriteBits(Magnitude(diff, dcSize), dcSize);
+
+        int last = 63;
+        while (last > 0 && coefficients[last] == 0) {
+            --last;
+        }
+        int zeros = 0;
+        for (int i = 1; i <= last; ++i) {
+            if (coefficients[i] == 0) {
+                ++zeros;
+                continue;
+            }
+            for (; zeros >= 16; zeros -= 16) {
+                WriteBits(ac.codes[0xf0], ac.lengths[0xf0]);
+            }
+            const int size = BitSize(coefficients[i]);
+            const int symbol = (zeros << 4) | size;
+            WriteBits(ac.codes[symbol], ac.lengths[symbol]);
+            WriteBits(Magnitude(coefficients[i], size), size);
+            zeros = 0;
+        }
+        if (last != 63) {
+            WriteBits(ac.codes[0x00], ac.lengths[0x00]);
+        }
+    }
+
+    static int BitSize(int value)
+    {
+        uint32_t magnitude = static_cast<uint32_t>(std::abs(value));
+        int size = 0;
+        while (magnitude) {
+            ++size;
+            magnitude >>= 1;
+        }
+        return size;
+    }
+
+    // negative values are sent as their ones' complement
+    static uint32_t Magnitude(int value, int size)
+    {
+        return static_cast<uint32_t>(value < 0 ? value - 1 : value) & ((1u << size) - 1);
+    }
+
+    void WriteBits(uint32_t bits, int count)
+    {
+        bitBuffer_ = (bitBuffer_ << count) | bits;
+        bitCount_ += count;
+        while (bitCount_ >= 8) {
+            const auto byte = static_cast<uint8_t>(bitBuffer_ >> (bitCount_ - 8));
+            bitCount_ -= 8;
+            output_.push_back(byte);
+            // byte stuffing
+            if (byte == 0xff) {
+                output_.push_back(0);
+            }
+        }
+        if (output_.size() >= OUTPUT_CHUNK) {
+            Flush();
+        }
+    }
+
+    void Flush()
+    {
+        sink_.Write(output_.data(), output_.size());
+        output_.clear();
+    }
+
+    static constexpr size_t OUTPUT_CHUNK = 64 * 1024;
+
+    ByteSink& sink_;
+    uint32_t width_;
+    uint32_t height_;
+    uint32_t paddedWidth_;
+    uint32_t rowsWritten_ = 0;
+    // RGB rows of the MCU row being filled, edge pixels replicated
+    std::vector<uint8_t> strip_;
+    uint32_t stripRows_ = 0;
+    uint8_t lumaQuant_[64];
+    uint8_t chromaQuant_[64];
+    float lumaDivisors_[64];
+    float chromaDivisors_[64];
+    HuffmanTable dcLuma_;
+    HuffmanTable dcChroma_;
+    HuffmanTable acLuma_;
+    HuffmanTable acChroma_;
+    int dcLumaPrevious_ = 0;
+    int dcCbPrevious_ = 0;
+    int dcCrPrevious_ = 0;
+    uint64_t bitBuffer_ = 0;
+    int bitCount_ = 0;
+    std::vector<uint8_t> output_;
+};
+} // namespace
+
+void Base64Sink::Write(const uint8_t* data, size_t size)
+{
+    while (pendingSize_ > 0 && pendingSize_ < 3 && size > 0) {
+        pending_[pendingSize_++] = *data++;
+        --size;
+    }
+    if (pendingSize_ == 3) {
+        AppendBase64Group(out_, pending_, 3);
+        pendingSize_ = 0;
+    }
+    // past the caller's estimate, grow geometrically: an exact reserve per
+    // chunk would copy the whole output on every Write
+    const size_t needed = out_.size() + (size + 2) / 3 * 4;
+    if (needed > out_.capacity()) {
+        out_.reserve(std::max(needed, out_.capacity() * 2));
+    }
+    for (; size >= 3; data += 3, size -= 3) {
+        AppendBase64Group(out_, data, 3);
+    }
+    std::memcpy(pending_ + pendingSize_, data, size);
+    pendingSize_ += size;
+}
+
+void Base64Sink::Finish()
+{
+    if (pendingSize_ > 0) {
+        AppendBase64Group(out_, pending_, pendingSize_);
+        pendingSize_ = 0;
+    }
+}
+
+std::unique_ptr<ImageEncoder> CreatePngEncoder(ByteSink& sink, uint32_t width, uint32_t height)
+{
+    return std::make_unique<PngEncoder>(sink, width, height);
+}
+
+std::unique_ptr<ImageEncoder> CreateJpegEncoder(ByteSink& sink, uint32_t width, uint32_t height, double quality)
+{
+    return std::make_unique<JpegEncoder>(sink, width, height, quality);
+}
+
+} // namespace rnoh
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace rnoh {
+
+// Receives encoded bytes as an encoder produces them.
+class ByteSink {
+public:
+    virtual ~ByteSink() = default;
+    virtual void Write(const uint8_t* data, size_t size) = 0;
+};
+
+// Base64 of everything written, appended to out as it arrives so the encoded
+// image is never held in binary form.
+class Base64Sink : public ByteSink {
+public:
+    explicit Base64Sink(std::string& out) : out_(out) {}
+
+    void Write(const uint8_t* data, size_t size) override;
+    // pads the last group, call once after the last Write
+    void Finish();
+
+private:
+    std::string& out_;
+    uint8_t pending_[3] = {};
+    size_t pendingSize_ = 0;
+};
+
+// Streaming image encoder: rows go in top to bottom in any batch size and
+// leave through the sink without the whole image being buffered.
+class ImageEncoder {
+public:
+    virtual ~ImageEncoder() = default;
+
+    // Premultiplied RGBA_8888 rows, stride bytes apart.
+    virtual bool WriteRows(const uint8_t* pixels, size_t stride, uint32_t rows) = 0;
+    // Flushes the image, call once after the last row.
+    virtual bool Finish() = 0;
+};
+
+// Lossless, straight alpha RGBA with per-row adaptive filtering.
+std::unique_ptr<ImageEncoder> CreatePngEncoder(ByteSink& sink, uint32_t width, uint32_t height);
+// Baseline 4:2:0 JFIF flattened onto white, quality in (0, 1].
+std::unique_ptr<ImageEncoder> CreateJpegEncoder(ByteSink& sink, uint32_t width, uint32_t height, double quality);
+
+} // namespace rnoh
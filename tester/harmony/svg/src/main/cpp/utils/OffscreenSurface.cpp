@@ -0,0 +1,67 @@
+#include "OffscreenSurface.h"
+#include <native_drawing/drawing_matrix.h>
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+namespace {
+constexpr float SCALE_BUCKETS = 8.0f;
+} // namespace
+
+OffscreenSurface::OffscreenSurface(uint32_t width, uint32_t height) : width_(width), height_(height)
+{
+    if (width_ == 0 || height_ == 0) {
+        return;
+    }
+    bitmap_ = OH_Drawing_BitmapCreate();
+    OH_Drawing_BitmapFormat format{COLOR_FORMAT_RGBA_8888, ALPHA_FORMAT_PREMUL};
+    OH_Drawing_BitmapBuild(bitmap_, width_, height_, &format);
+    pixels_ = static_cast<uint8_t*>(OH_Drawing_BitmapGetPixels(bitmap_));
+    if (!pixels_) {
+        LOG(WARNING) << "[OffscreenSurface] failed to allocate " << width_ << "x" << height_;
+        return;
+    }
+    canvas_ = OH_Drawing_CanvasCreate();
+    OH_Drawing_CanvasBind(canvas_, bitmap_);
+    OH_Drawing_CanvasClear(canvas_, 0x00000000);
+}
+
+OffscreenSurface::~OffscreenSurface()
+{
+    if (image_) {
+        OH_Drawing_ImageDestroy(image_);
+    }
+    if (canvas_) {
+        OH_Drawing_CanvasDestroy(canvas_);
+    }
+    if (bitmap_) {
+        OH_Drawing_BitmapDestroy(bitmap_);
+    }
+}
+
+OH_Drawing_Image* OffscreenSurface::GetImage()
+{
+    if (!image_ && IsValid()) {
+        image_ = OH_Drawing_ImageCreate();
+        OH_Drawing_ImageBuildFromBitmap(image_, bitmap_);
+    }
+    return image_;
+}
+
+float GetCanvasScale(OH_Drawing_Canvas* canvas)
+{
+    auto* matrix = OH_Drawing_MatrixCreate();
+    OH_Drawing_CanvasGetTotalMatrix(canvas, matrix);
+    const float scaleX = std::hypot(OH_Drawing_MatrixGetValue(matrix, 0), OH_Drawing_MatrixGetValue(matrix, 3));
+    const float scaleY = std::hypot(OH_Drawing_MatrixGetValue(matrix, 1), OH_Drawing_MatrixGetValue(matrix, 4));
+    OH_Drawing_MatrixDestroy(matrix);
+    return std::max(scaleX, scaleY);
+}
+
+float ScaleBucket(float scale)
+{
+    return scale > 0.0f ? std::ceil(scale * SCALE_BUCKETS) / SCALE_BUCKETS : 1.0f;
+}
+
+} // namespace rnoh
@@ -0,0 +1,64 @@
+#pragma once
+#include <native_drawing/drawing_bitmap.h>
+#include <native_drawing/drawing_canvas.h>
+#include <native_drawing/drawing_image.h>
+#include <cstdint>
+
+namespace rnoh {
+
+// Bitmap backed canvas for rendering a subtree at device resolution, owns the
+// bitmap, the canvas bound to it and the image snapshot taken from it.
+class OffscreenSurface {
+public:
+    OffscreenSurface(uint32_t width, uint32_t height);
+    ~OffscreenSurface();
+
+    OffscreenSurface(const OffscreenSurface&) = delete;
+    OffscreenSurface& operator=(const OffscreenSurface&) = delete;
+
+    bool IsValid() const
+    {
+        return pixels_ != nullptr;
+    }
+
+    uint32_t Width() const
+    {
+        return width_;
+    }
+
+    uint32_t Height() const
+    {
+        return height_;
+    }
+
+    OH_Drawing_Canvas* GetCanvas()
+    {
+        return canvas_;
+    }
+
+    // premultiplied RGBA_8888, Width() * Height() pixels without row padding
+    uint8_t* GetPixels()
+    {
+        return pixels_;
+    }
+
+    // Snapshot of the pixels, taken once: finish drawing before calling.
+    OH_Drawing_Image* GetImage();
+
+private:
+    uint32_t width_;
+    uint32_t height_;
+    OH_Drawing_Bitmap* bitmap_ = nullptr;
+    OH_Drawing_Canvas* canvas_ = nullptr;
+    OH_Drawing_Image* image_ = nullptr;
+    uint8_t* pixels_ = nullptr;
+};
+
+// Scale from the canvas' user space to device pixels.
+float GetCanvasScale(OH_Drawing_Canvas* canvas);
+
+// Rounds scale up to 1/8 steps so rasters cached against it survive small
+// zoom changes.
+float ScaleBucket(float scale);
+
+} // namespace rnoh
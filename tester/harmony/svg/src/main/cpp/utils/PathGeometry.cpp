@@ -0,0 +1,528 @@
+#include "PathGeometry.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+
+namespace rnoh {
+namespace {
+constexpr double PI = 3.14159265358979323846;
+constexpr double RAD_TO_DEG = 180.0 / PI;
+// arc length tables flatten curves into segments of about CURVE_STEP user units
+constexpr float CURVE_STEP = 2.0f;
+constexpr int MAX_CURVE_SEGMENTS = 64;
+
+class PathDataParser {
+public:
+    PathDataParser(const std::string& d, PathData& data) : cur_(d.c_str()), end_(d.c_str() + d.size()), data_(data) {}
+
+    bool Parse()
+    {
+        char command = 0;
+        while (SkipSeparators()) {
+            if (IsCommand(*cur_)) {
+                command = *cur_++;
+            } else if (command == 0 || command == 'Z' || command == 'z') {
+                return false;
+            }
+            if (!ParseSegment(command)) {
+                return false;
+            }
+            previous_ = command;
+            // coordinates after a moveto are implicit linetos
+            if (command == 'M') {
+                command = 'L';
+            } else if (command == 'm') {
+                command = 'l';
+            }
+        }
+        return true;
+    }
+
+private:
+    static bool IsCommand(char c)
+    {
+        switch (c) {
+            case 'M': case 'm': case 'L': case 'l': case 'H': case 'h': case 'V': case 'v': case 'C': case 'c':
+            case 'S': case 's': case 'Q': case 'q': case 'T': case 't': case 'A': case 'a': case 'Z': case 'z':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // returns false at the end of input
+    bool SkipSeparators()
+    {
+        while (cur_ < end_ && (*cur_ == ' ' || *cur_ == ',' || *cur_ == '\t' || *cur_ == '\n' || *cur_ == '\r')) {
+            ++cur_;
+        }
+        return cur_ < end_;
+    }
+
+    bool Number(float& value)
+    {
+        if (!SkipSeparators()) {
+            return false;
+        }
+        char* numberEnd = nullptr;
+        value = std::strtof(cur_, &numberEnd);
+        if (numberEnd == cur_) {
+            return false;
+        }
+        cur_ = numberEnd;
+        return true;
+    }
+
+    // arc flags may be written without separators, e.g. "a1 1 0 00 1 1"
+    bool Flag(bool& value)
+    {
+        if (!SkipSeparators() || (*cur_ != '0' && *cur_ != '1')) {
+            return false;
+        }
+        value = *cur_++ == '1';
+        return true;
+    }
+
+    bool Point(PathPoint& point, bool relative)
+    {
+        if (!Number(point.x) || !Number(point.y)) {
+            return false;
+        }
+        if (relative) {
+            point.x += current_.x;
+            point.y += current_.y;
+        }
+        return true;
+    }
+
+    void Emit(PathVerb verb, std::initializer_list<PathPoint> points)
+    {
+        data_.verbs.push_back(verb);
+        data_.points.insert(data_.points.end(), points);
+    }
+
+    bool ParseSegment(char command)
+    {
+        const bool relative = command >= 'a';
+        PathPoint p1{};
+        PathPoint p2{};
+        PathPoint p3{};
+        switch (command) {
+            case 'M': case 'm':
+                if (!Point(p1, relative)) {
+                    return false;
+                }
+                Emit(PathVerb::MOVE, {p1});
+                start_ = p1;
+                break;
+            case 'L': case 'l':
+                if (!Point(p1, relative)) {
+                    return false;
+                }
+                Emit(PathVerb::LINE, {p1});
+                break;
+            case 'H': case 'h':
+                if (!Number(p1.x)) {
+                    return false;
+                }
+                p1 = {relative ? current_.x + p1.x : p1.x, current_.y};
+                Emit(PathVerb::LINE, {p1});
+                break;
+            case 'V': case 'v':
+                if (!Number(p1.y)) {
+                    return false;
+                }
+                p1 = {current_.x, relative ? current_.y + p1.y : p1.y};
+                Emit(PathVerb::LINE, {p1});
+                break;
+            case 'C': case 'c':
+                if (!Point(p1, relative) || !Point(p2, relative) || !Point(p3, relative)) {
+                    return false;
+                }
+                Emit(PathVerb::CUBIC, {p1, p2, p3});
+                control_ = p2;
+                break;
+            case 'S': case 's':
+                if (!Point(p2, relative) || !Point(p3, relative)) {
+                    return false;
+                }
+                p1 = Reflect(PathVerb::CUBIC);
+                Emit(PathVerb::CUBIC, {p1, p2, p3});
+                control_ = p2;
+                break;
+            case 'Q': case 'q':
+                if (!Point(p1, relative) || !Point(p2, relative)) {
+                    return false;
+                }
+                Emit(PathVerb::QUAD, {p1, p2});
+                control_ = p1;
+                break;
+            case 'T': case 't':
+                if (!Point(p2, relative)) {
+                    return false;
+                }
+                p1 = Reflect(PathVerb::QUAD);
+                Emit(PathVerb::QUAD, {p1, p2});
+                control_ = p1;
+                break;
+            case 'A': case 'a':
+                // a degenerate arc emits nothing, current_ is its endpoint either way
+                return ParseArc(relative);
+            case 'Z': case 'z':
+                Emit(PathVerb::CLOSE, {});
+                current_ = start_;
+                return true;
+            default:
+                return false;
+        }
+        if (!data_.points.empty()) {
+            current_ = data_.points.back();
+        }
+        return true;
+    }
+
+    // first control point of S/T, the reflection of the previous one when the
+    // previous command was a curve of the same kind; arcs emit cubics too
+    PathPoint Reflect(PathVerb verb) const
+    {
+        const char previous = static_cast<char>(std::toupper(static_cast<unsigned char>(previous_)));
+        const bool smooth = verb == PathVerb::CUBIC ? previous == 'C' || previous == 'S'
+                                                    : previous == 'Q' || previous == 'T';
+        if (!smooth) {
+            return current_;
+        }
+        return {2 * current_.x - control_.x, 2 * current_.y - control_.y};
+    }
+
+    bool ParseArc(bool relative)
+    {
+        float rx = 0.0f;
+        float ry = 0.0f;
+        float rotation = 0.0f;
+        bool largeArc = false;
+        bool sweep = false;
+        PathPoint to{};
+        if (!Number(rx) || !Number(ry) || !Number(rotation) || !Flag(largeArc) || !Flag(sweep) ||
+            !Point(to, relative)) {
+            return false;
+        }
+        AppendArc(std::fabs(rx), std::fabs(ry), rotation, largeArc, sweep, to);
+        current_ = to;
+        return true;
+    }
+
+    // endpoint to center parameterization, SVG 1.1 appendix F.6.5
+    void AppendArc(double rx, double ry, double rotation, bool largeArc, bool sweep, PathPoint to)
+    {
+        const PathPoint from = current_;
+        if ((from.x == to.x && from.y == to.y)) {
+            return;
+        }
+        if (rx == 0.0 || ry == 0.0) {
+            Emit(PathVerb::LINE, {to});
+            return;
+        }
+        const double phi = rotation * PI / 180.0;
+        const double cosPhi = std::cos(phi);
+        const double sinPhi = std::sin(phi);
+        const double dx = (from.x - to.x) / 2.0;
+        const double dy = (from.y - to.y) / 2.0;
+        const double x1 = cosPhi * dx + sinPhi * dy;
+        const double y1 = -sinPhi * dx + cosPhi * dy;
+        const double lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+        if (lambda > 1.0) {
+            rx *= std::sqrt(lambda);
+            ry *= std::sqrt(lambda);
+        }
+        const double rx2 = rx * rx;
+        const double ry2 = ry * ry;
+        double factor = (rx2 * ry2 - rx2 * y1 * y1 - ry2 * x1 * x1) / (rx2 * y1 * y1 + ry2 * x1 * x1);
+        factor = std::sqrt(std::max(0.0, factor)) * (largeArc == sweep ? -1.0 : 1.0);
+        const double cx1 = factor * rx * y1 / ry;
+        const double cy1 = -factor * ry * x1 / rx;
+        const double cx = cosPhi * cx1 - sinPhi * cy1 + (from.x + to.x) / 2.0;
+        const double cy = sinPhi * cx1 + cosPhi * cy1 + (from.y + to.y) / 2.0;
+        const double theta = std::atan2((y1 - cy1) / ry, (x1 - cx1) / rx);
+        double delta = std::atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx) - theta;
+        if (sweep && delta < 0) {
+            delta += 2 * PI;
+        } else if (!sweep && delta > 0) {
+            delta -= 2 * PI;
+        }
+        // at most a quarter turn per cubic keeps the error below 0.03%
+        const int segments = static_cast<int>(std::ceil(std::fabs(delta) / (PI / 2) - 1e-6));
+        const double step = delta / segments;
+        const double k = 4.0 / 3.0 * std::tan(step / 4);
+        double angle = theta;
+        for (int i = 0; i < segments; ++i) {
+            const double cos1 = std::cos(angle);
+            const double sin1 = std::sin(angle);
+            const double cos2 = std::cos(angle + step);
+            const double sin2 = std::sin(angle + step);
+            auto map = [&](double x, double y) {
+                return PathPoint{static_cast<float>(cx + rx * x * cosPhi - ry * y * sinPhi),
+                                 static_cast<float>(cy + rx * x * sinPhi + ry * y * cosPhi)};
+            };
+            const PathPoint end = i == segments - 1 ? to : map(cos2, sin2);
+            Emit(PathVerb::CUBIC, {map(cos1 - k * sin1, sin1 + k * cos1), map(cos2 + k * sin2, sin2 - k * cos2), end});
+            angle += step;
+        }
+    }
+
+    const char* cur_;
+    const char* end_;
+    PathData& data_;
+    PathPoint current_{};
+    PathPoint start_{};
+    PathPoint control_{};
+    char previous_ = 0;
+};
+
+struct Direction {
+    float dx = 0.0f;
+    float dy = 0.0f;
+    bool valid = false;
+};
+
+Direction MakeDirection(PathPoint from, PathPoint to)
+{
+    return {to.x - from.x, to.y - from.y, from.x != to.x || from.y != to.y};
+}
+
+// first of the candidate directions that is not degenerate
+Direction FirstDirection(std::initializer_list<Direction> candidates)
+{
+    for (const auto& direction : candidates) {
+        if (direction.valid) {
+            return direction;
+        }
+    }
+    return {};
+}
+
+struct VertexDirections {
+    PathPoint point;
+    Direction in;
+    Direction out;
+};
+
+float VertexAngle(const VertexDirections& vertex)
+{
+    if (vertex.in.valid && vertex.out.valid) {
+        const double in = std::atan2(vertex.in.dy, vertex.in.dx);
+        double turn = std::atan2(vertex.out.dy, vertex.out.dx) - in;
+        if (turn > PI) {
+            turn -= 2 * PI;
+        } else if (turn < -PI) {
+            turn += 2 * PI;
+        }
+        return static_cast<float>((in + turn / 2) * RAD_TO_DEG);
+    }
+    const auto& direction = vertex.in.valid ? vertex.in : vertex.out;
+    return direction.valid ? static_cast<float>(std::atan2(direction.dy, direction.dx) * RAD_TO_DEG) : 0.0f;
+}
+} // namespace
+
+bool ParsePathData(const std::string& d, PathData& data)
+{
+    data.Clear();
+    return PathDataParser(d, data).Parse();
+}
+
+void AppendPathData(const PathData& data, OH_Drawing_Path* path, float scale)
+{
+    const PathPoint* p = data.points.data();
+    for (auto verb : data.verbs) {
+        switch (verb) {
+            case PathVerb::MOVE:
+                OH_Drawing_PathMoveTo(path, p[0].x * scale, p[0].y * scale);
+                p += 1;
+                break;
+            case PathVerb::LINE:
+                OH_Drawing_PathLineTo(path, p[0].x * scale, p[0].y * scale);
+                p += 1;
+                break;
+            case PathVerb::QUAD:
+                OH_Drawing_PathQuadTo(path, p[0].x * scale, p[0].y * scale, p[1].x * scale, p[1].y * scale);
+                p += 2;
+                break;
+            case PathVerb::CUBIC:
+                OH_Drawing_PathCubicTo(path, p[0].x * scale, p[0].y * scale, p[1].x * scale, p[1].y * scale,
+                                       p[2].x * scale, p[2].y * scale);
+                p += 3;
+                break;
+            case PathVerb::CLOSE:
+                OH_Drawing_PathClose(path);
+                break;
+        }
+    }
+}
+
+void ComputeMarkerVertices(const PathData& data, std::vector<MarkerVertex>& vertices)
+{
+    std::vector<VertexDirections> directions;
+    directions.reserve(data.points.size());
+    const PathPoint* p = data.points.data();
+    PathPoint current{};
+    size_t subpathStart = 0;
+    // appends the vertex a segment ends at, setting the outgoing direction
+    // of the vertex it starts from
+    auto segment = [&](PathPoint end, Direction out, Direction in) {
+        if (!directions.empty() && !directions.back().out.valid) {
+            directions.back().out = out;
+        }
+        directions.push_back({end, in, {}});
+        current = end;
+    };
+    for (auto verb : data.verbs) {
+        switch (verb) {
+            case PathVerb::MOVE:
+                subpathStart = directions.size();
+                directions.push_back({p[0], {}, {}});
+                current = p[0];
+                p += 1;
+                break;
+            case PathVerb::LINE: {
+                auto direction = MakeDirection(current, p[0]);
+                segment(p[0], direction, direction);
+                p += 1;
+                break;
+            }
+            case PathVerb::QUAD: {
+                auto chord = MakeDirection(current, p[1]);
+                segment(p[1], FirstDirection({MakeDirection(current, p[0]), chord}),
+                        FirstDirection({MakeDirection(p[0], p[1]), chord}));
+                p += 2;
+                break;
+            }
+            case PathVerb::CUBIC: {
+                segment(p[2], FirstDirection({MakeDirection(current, p[0]), MakeDirection(current, p[1]),
+                                              MakeDirection(current, p[2])}),
+                        FirstDirection({MakeDirection(p[1], p[2]), MakeDirection(p[0], p[2]),
+                                        MakeDirection(current, p[2])}));
+                p += 3;
+                break;
+            }
+            case PathVerb::CLOSE: {
+                if (subpathStart >= directions.size()) {
+                    break;
+                }
+                const auto start = directions[subpathStart].point;
+                auto direction = MakeDirection(current, start);
+                segment(start, direction, direction);
+                // the closing vertex joins the last segment to the first one
+                if (subpathStart + 1 < directions.size()) {
+                    directions.back().out = directions[subpathStart].out;
+                    directions[subpathStart].in = directions.back().in;
+                }
+                break;
+            }
+        }
+    }
+    vertices.clear();
+    vertices.reserve(directions.size());
+    for (size_t i = 0; i < directions.size(); ++i) {
+        auto position = i == 0 ? MarkerPosition::START
+                               : (i + 1 == directions.size() ? MarkerPosition::END : MarkerPosition::MID);
+        vertices.push_back({directions[i].point, VertexAngle(directions[i]), position});
+    }
+}
+
+void BuildArcLengthTable(const PathData& data, ArcLengthTable& table)
+{
+    table.Clear();
+    table.points.reserve(data.points.size());
+    table.lengths.reserve(data.points.size());
+    const PathPoint* p = data.points.data();
+    PathPoint current{};
+    PathPoint subpathStart{};
+    float length = 0.0f;
+    auto lineTo = [&](PathPoint point) {
+        if (table.points.empty()) {
+            table.points.push_back(current);
+            table.lengths.push_back(0.0f);
+        }
+        length += std::hypot(point.x - current.x, point.y - current.y);
+        table.points.push_back(point);
+        table.lengths.push_back(length);
+        current = point;
+    };
+    auto segmentsFor = [](float hull) {
+        return std::clamp(static_cast<int>(std::ceil(hull / CURVE_STEP)), 1, MAX_CURVE_SEGMENTS);
+    };
+    auto distance = [](PathPoint a, PathPoint b) { return std::hypot(b.x - a.x, b.y - a.y); };
+    for (auto verb : data.verbs) {
+        switch (verb) {
+            case PathVerb::MOVE:
+                current = p[0];
+                subpathStart = p[0];
+                table.points.push_back(current);
+                table.lengths.push_back(length);
+                p += 1;
+                break;
+            case PathVerb::LINE:
+                lineTo(p[0]);
+                p += 1;
+                break;
+            case PathVerb::QUAD: {
+                const PathPoint p0 = current;
+                const int segments = segmentsFor(distance(p0, p[0]) + distance(p[0], p[1]));
+                for (int i = 1; i <= segments; ++i) {
+                    const float t = static_cast<float>(i) / segments;
+                    const float u = 1.0f - t;
+                    lineTo({u * u * p0.x + 2 * u * t * p[0].x + t * t * p[1].x,
+                            u * u * p0.y + 2 * u * t * p[0].y + t * t * p[1].y});
+                }
+                p += 2;
+                break;
+            }
+            case PathVerb::CUBIC: {
+                const PathPoint p0 = current;
+                const int segments = segmentsFor(distance(p0, p[0]) + distance(p[0], p[1]) + distance(p[1], p[2]));
+                for (int i = 1; i <= segments; ++i) {
+                    const float t = static_cast<float>(i) / segments;
+                    const float u = 1.0f - t;
+                    const float a = u * u * u;
+                    const float b = 3 * u * u * t;
+                    const float c = 3 * u * t * t;
+                    const float d = t * t * t;
+                    lineTo({a * p0.x + b * p[0].x + c * p[1].x + d * p[2].x,
+                            a * p0.y + b * p[0].y + c * p[1].y + d * p[2].y});
+                }
+                p += 3;
+                break;
+            }
+            case PathVerb::CLOSE:
+                lineTo(subpathStart);
+                break;
+        }
+    }
+}
+
+bool SampleArcLength(const ArcLengthTable& table, float distance, PathPoint& point, float& angle)
+{
+    const auto& lengths = table.lengths;
+    if (lengths.size() < 2 || distance < 0.0f || distance > lengths.back()) {
+        return false;
+    }
+    // first vertex past distance, so the segment before it has a length and
+    // the zero length jumps between contours are skipped
+    size_t i = std::upper_bound(lengths.begin(), lengths.end(), distance) - lengths.begin();
+    if (i == lengths.size()) {
+        i = lengths.size() - 1;
+        while (i > 1 && lengths[i] == lengths[i - 1]) {
+            --i;
+        }
+    }
+    const PathPoint& from = table.points[i - 1];
+    const PathPoint& to = table.points[i];
+    const float segment = lengths[i] - lengths[i - 1];
+    const float t = segment > 0.0f ? (distance - lengths[i - 1]) / segment : 0.0f;
+    point = {from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t};
+    angle = static_cast<float>(std::atan2(to.y - from.y, to.x - from.x) * RAD_TO_DEG);
+    return true;
+}
+
+} // namespace rnoh
@@ -0,0 +1,86 @@
+#pragma once
+#include <native_drawing/drawing_path.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rnoh {
+
+enum class PathVerb : uint8_t {
+    MOVE,
+    LINE,
+    QUAD,
+    CUBIC,
+    CLOSE,
+};
+
+struct PathPoint {
+    float x;
+    float y;
+};
+
+// Absolute path geometry in user units, arcs are converted to cubics.
+// points holds 1 entry per MOVE/LINE, 2 per QUAD, 3 per CUBIC, none per CLOSE.
+struct PathData {
+    std::vector<PathVerb> verbs;
+    std::vector<PathPoint> points;
+
+    void Clear()
+    {
+        verbs.clear();
+        points.clear();
+    }
+
+    bool Empty() const
+    {
+        return verbs.empty();
+    }
+};
+
+// Parses SVG path data in a single pass. On an error data keeps the segments
+// before it, which is what gets rendered per the spec, and false is returned.
+bool ParsePathData(const std::string& d, PathData& data);
+
+// Appends data to path with every coordinate multiplied by scale.
+void AppendPathData(const PathData& data, OH_Drawing_Path* path, float scale);
+
+enum class MarkerPosition : uint8_t {
+    START,
+    MID,
+    END,
+};
+
+struct MarkerVertex {
+    PathPoint point;
+    float angle; // degrees, bisecting the incoming and outgoing directions
+    MarkerPosition position;
+};
+
+// Marker positions and orientations of every vertex of data.
+void ComputeMarkerVertices(const PathData& data, std::vector<MarkerVertex>& vertices);
+
+// data flattened to a polyline with the distance from the path start at each
+// vertex, in user units. A MOVE starts a new contour without adding length.
+struct ArcLengthTable {
+    std::vector<PathPoint> points;
+    std::vector<float> lengths;
+
+    void Clear()
+    {
+        points.clear();
+        lengths.clear();
+    }
+
+    float Total() const
+    {
+        return lengths.empty() ? 0.0f : lengths.back();
+    }
+};
+
+void BuildArcLengthTable(const PathData& data, ArcLengthTable& table);
+
+// Point at distance along table and the direction of travel there, in
+// degrees. False when distance lies outside [0, Total()].
+bool SampleArcLength(const ArcLengthTable& table, float distance, PathPoint& point, float& angle);
+
+} // namespace rnoh
@@ -0,0 +1,77 @@
+#include "RasterCache.h"
+#include "Utils.h"
+
+namespace rnoh {
+
+RasterCache& RasterCache::GetInstance()
+{
+    static RasterCache cache;
+    return cache;
+}
+
+size_t RasterCache::KeyHash::operator()(const RasterCacheKey& key) const
+{
+    size_t seed = key.contentHash.low;
+    HashCombine(seed, key.width);
+    HashCombine(seed, key.height);
+    HashCombine(seed, key.scale);
+    HashCombine(seed, key.density);
+    HashCombine(seed, key.tintColor);
+    return seed;
+}
+
+std::shared_ptr<OffscreenSurface> RasterCache::Get(const RasterCacheKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+}
+
+void RasterCache::Put(const RasterCacheKey& key, const std::shared_ptr<OffscreenSurface>& surface)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!surface || GetBytes(*surface) > budget_) {
+        return;
+    }
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        bytes_ -= GetBytes(*it->second->second);
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    entries_.emplace_front(key, surface);
+    index_[key] = entries_.begin();
+    bytes_ += GetBytes(*surface);
+    Trim();
+}
+
+void RasterCache::SetBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = bytes;
+    Trim();
+}
+
+void RasterCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+void RasterCache::Trim()
+{
+    while (bytes_ > budget_ && !entries_.empty()) {
+        const auto& last = entries_.back();
+        bytes_ -= GetBytes(*last.second);
+        index_.erase(last.first);
+        entries_.pop_back();
+    }
+}
+
+} // namespace rnoh
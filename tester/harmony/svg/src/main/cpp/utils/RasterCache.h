@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "OffscreenSurface.h"
+#include "Utils.h"
+
+namespace rnoh {
+
+// Identifies a rendered document: same content drawn at the same pixel size,
+// scale bucket, density and tint gives the same raster.
+struct RasterCacheKey {
+    // both lanes must match, rasters are shared between documents
+    WideHash contentHash;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    float scale = 1.0f;
+    float density = 1.0f;
+    uint32_t tintColor = 0;
+
+    bool operator==(const RasterCacheKey& other) const
+    {
+        return contentHash == other.contentHash && width == other.width && height == other.height &&
+               scale == other.scale && density == other.density && tintColor == other.tintColor;
+    }
+};
+
+// Process wide LRU of whole-document rasters bounded by a byte budget. Views
+// showing the same document share one entry; a raster evicted while a view
+// still holds it stays alive until that view lets go.
+class RasterCache {
+public:
+    static constexpr size_t DEFAULT_BUDGET = 32 * 1024 * 1024;
+
+    static RasterCache& GetInstance();
+
+    std::shared_ptr<OffscreenSurface> Get(const RasterCacheKey& key);
+    // Rasters larger than the whole budget are not kept.
+    void Put(const RasterCacheKey& key, const std::shared_ptr<OffscreenSurface>& surface);
+    void SetBudget(size_t bytes);
+    void Clear();
+
+private:
+    RasterCache() = default;
+
+    struct KeyHash {
+        size_t operator()(const RasterCacheKey& key) const;
+    };
+    using Entry = std::pair<RasterCacheKey, std::shared_ptr<OffscreenSurface>>;
+
+    static size_t GetBytes(const OffscreenSurface& surface)
+    {
+        return static_cast<size_t>(surface.Width()) * surface.Height() * 4;
+    }
+    // evicts least recently used entries until the budget holds, mutex_ held
+    void Trim();
+
+    std::mutex mutex_;
+    // most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<RasterCacheKey, std::list<Entry>::iterator, KeyHash> index_;
+    size_t bytes_ = 0;
+    size_t budget_ = DEFAULT_BUDGET;
+};
+
+} // namespace rnoh
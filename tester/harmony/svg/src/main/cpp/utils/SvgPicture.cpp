@@ -0,0 +1,62 @@
+#include "SvgPicture.h"
+#include <glog/logging.h>
+#include <cmath>
+
+namespace rnoh {
+
+std::shared_ptr<SvgPicture> SvgPicture::Record(int32_t width, int32_t height,
+                                               const std::function<void(OH_Drawing_Canvas*)>& draw)
+{
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    auto* recorder = OH_Drawing_RecordCmdUtilsCreate();
+    OH_Drawing_Canvas* canvas = nullptr;
+    OH_Drawing_RecordCmd* recordCmd = nullptr;
+    if (OH_Drawing_RecordCmdUtilsBeginRecording(recorder, width, height, &canvas) == 0 && canvas) {
+        draw(canvas);
+        OH_Drawing_RecordCmdUtilsFinishRecording(recorder, &recordCmd);
+    }
+    OH_Drawing_RecordCmdUtilsDestroy(recorder);
+    if (!recordCmd) {
+        LOG(WARNING) << "[SvgPicture] failed to record " << width << "x" << height;
+        return nullptr;
+    }
+    return std::make_shared<SvgPicture>(recordCmd);
+}
+
+std::shared_ptr<SvgPicture> SvgPicture::Record(const Rect& bounds,
+                                               const std::function<void(OH_Drawing_Canvas*)>& draw)
+{
+    const float left = std::floor(bounds.Left());
+    const float top = std::floor(bounds.Top());
+    auto picture = Record(static_cast<int32_t>(std::ceil(bounds.Right() - left)),
+                          static_cast<int32_t>(std::ceil(bounds.Bottom() - top)), [&](OH_Drawing_Canvas* canvas) {
+                              OH_Drawing_CanvasTranslate(canvas, -left, -top);
+                              draw(canvas);
+                          });
+    if (!picture) {
+        return nullptr;
+    }
+    picture->left_ = left;
+    picture->top_ = top;
+    return picture;
+}
+
+SvgPicture::~SvgPicture()
+{
+    OH_Drawing_RecordCmdDestroy(recordCmd_);
+}
+
+void SvgPicture::Draw(OH_Drawing_Canvas* canvas) const
+{
+    if (left_ == 0.0f && top_ == 0.0f) {
+        OH_Drawing_CanvasDrawRecordCmd(canvas, recordCmd_);
+        return;
+    }
+    OH_Drawing_CanvasTranslate(canvas, left_, top_);
+    OH_Drawing_CanvasDrawRecordCmd(canvas, recordCmd_);
+    OH_Drawing_CanvasTranslate(canvas, -left_, -top_);
+}
+
+} // namespace rnoh
@@ -0,0 +1,38 @@
+#pragma once
+#include <native_drawing/drawing_canvas.h>
+#include <native_drawing/drawing_record_cmd.h>
+#include <functional>
+#include <memory>
+#include "properties/Rect.h"
+
+namespace rnoh {
+
+// Immutable recorded draw commands, replayed onto any canvas without
+// traversing the nodes that produced them.
+class SvgPicture {
+public:
+    // Records what draw paints into a width x height canvas, nullptr if the
+    // recording could not be made.
+    static std::shared_ptr<SvgPicture> Record(int32_t width, int32_t height,
+                                              const std::function<void(OH_Drawing_Canvas*)>& draw);
+    // Same, for content covering bounds anywhere in user space: the recording
+    // is shifted to start at the origin and shifted back on replay.
+    static std::shared_ptr<SvgPicture> Record(const Rect& bounds,
+                                              const std::function<void(OH_Drawing_Canvas*)>& draw);
+
+    SvgPicture(OH_Drawing_RecordCmd* recordCmd, float left = 0.0f, float top = 0.0f)
+        : recordCmd_(recordCmd), left_(left), top_(top) {}
+    ~SvgPicture();
+
+    SvgPicture(const SvgPicture&) = delete;
+    SvgPicture& operator=(const SvgPicture&) = delete;
+
+    void Draw(OH_Drawing_Canvas* canvas) const;
+
+private:
+    OH_Drawing_RecordCmd* recordCmd_;
+    float left_;
+    float top_;
+};
+
+} // namespace rnoh
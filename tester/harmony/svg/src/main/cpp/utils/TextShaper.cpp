@@ -0,0 +1,74 @@
+#include "TextShaper.h"
+#include "FontCache.h"
+
+namespace rnoh {
+
+TextFont::TextFont(const FontSpec& spec)
+    : spec_(spec), typeface_(FontCache::GetInstance().GetTypeface({spec.family, spec.weight, spec.width, spec.italic}))
+{
+    font_ = OH_Drawing_FontCreate();
+    OH_Drawing_FontSetTypeface(font_, typeface_.get());
+    OH_Drawing_FontSetTextSize(font_, spec.size);
+    OH_Drawing_FontGetMetrics(font_, &metrics_);
+}
+
+TextFont::~TextFont()
+{
+    OH_Drawing_FontDestroy(font_);
+}
+
+void TextFont::Shape(const std::u32string& text, std::vector<uint16_t>& glyphs, std::vector<float>& advances) const
+{
+    glyphs.assign(text.size(), 0);
+    advances.assign(text.size(), 0.0f);
+    if (text.empty()) {
+        return;
+    }
+    const auto count = OH_Drawing_FontTextToGlyphs(font_, text.data(), text.size() * sizeof(char32_t),
+                                                   TEXT_ENCODING_UTF32, glyphs.data(), glyphs.size());
+    glyphs.resize(count);
+    advances.resize(count);
+    OH_Drawing_FontGetWidths(font_, glyphs.data(), count, advances.data());
+}
+
+std::u32string DecodeUtf8(const std::string& text)
+{
+    constexpr char32_t REPLACEMENT = 0xFFFD;
+    std::u32string result;
+    result.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        const auto lead = static_cast<uint8_t>(text[i]);
+        size_t length = 0;
+        char32_t codePoint = 0;
+        if (lead < 0x80) {
+            length = 1;
+            codePoint = lead;
+        } else if ((lead & 0xE0) == 0xC0) {
+            length = 2;
+            codePoint = lead & 0x1F;
+        } else if ((lead & 0xF0) == 0xE0) {
+            length = 3;
+            codePoint = lead & 0x0F;
+        } else if ((lead & 0xF8) == 0xF0) {
+            length = 4;
+            codePoint = lead & 0x07;
+        }
+        bool valid = length > 0 && i + length <= text.size();
+        for (size_t k = 1; valid && k < length; ++k) {
+            const auto next = static_cast<uint8_t>(text[i + k]);
+            valid = (next & 0xC0) == 0x80;
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+        if (!valid) {
+            result.push_back(REPLACEMENT);
+            ++i;
+            continue;
+        }
+        result.push_back(codePoint);
+        i += length;
+    }
+    return result;
+}
+
+} // namespace rnoh
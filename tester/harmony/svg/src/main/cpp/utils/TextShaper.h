@@ -0,0 +1,75 @@
+#pragma once
+#include <native_drawing/drawing_font.h>
+#include <native_drawing/drawing_typeface.h>
+#include <native_drawing/drawing_types.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rnoh {
+
+// Font of a text element after inheritance, size in px.
+struct FontSpec {
+    std::string family;
+    float size = 0.0f;
+    int weight = 400;
+    // font-stretch on the 1-9 width scale
+    int width = 5;
+    bool italic = false;
+
+    bool operator==(const FontSpec& other) const
+    {
+        return family == other.family && size == other.size && weight == other.weight && width == other.width &&
+               italic == other.italic;
+    }
+    bool operator!=(const FontSpec& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// An OH_Drawing_Font set up for one FontSpec, on a typeface shared through
+// FontCache. The drawing API has no shaping engine, characters map one to
+// one onto glyphs, so ligatures and joined scripts render in their isolated
+// forms.
+class TextFont {
+public:
+    explicit TextFont(const FontSpec& spec);
+    ~TextFont();
+
+    TextFont(const TextFont&) = delete;
+    TextFont& operator=(const TextFont&) = delete;
+
+    OH_Drawing_Font* Get() const
+    {
+        return font_;
+    }
+    const FontSpec& GetSpec() const
+    {
+        return spec_;
+    }
+    const std::shared_ptr<OH_Drawing_Typeface>& GetTypeface() const
+    {
+        return typeface_;
+    }
+    // ascent is negative, measured from the baseline
+    const OH_Drawing_Font_Metrics& GetMetrics() const
+    {
+        return metrics_;
+    }
+
+    // One glyph id and advance in px per code point of text.
+    void Shape(const std::u32string& text, std::vector<uint16_t>& glyphs, std::vector<float>& advances) const;
+
+private:
+    FontSpec spec_;
+    std::shared_ptr<OH_Drawing_Typeface> typeface_;
+    OH_Drawing_Font* font_ = nullptr;
+    OH_Drawing_Font_Metrics metrics_{};
+};
+
+// Malformed sequences decode to U+FFFD.
+std::u32string DecodeUtf8(const std::string& text);
+
+} // namespace rnoh
@@ -0,0 +1,187 @@
+#include "TransformParser.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace rnoh {
+namespace {
+constexpr int MAX_TRANSFORM_ARGS = 6;
+
+bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+const char* SkipSpaces(const char* cur, const char* end)
+{
+    while (cur < end && IsSpace(*cur)) {
+        ++cur;
+    }
+    return cur;
+}
+
+const char* SkipSeparators(const char* cur, const char* end)
+{
+    while (cur < end && (IsSpace(*cur) || *cur == ',')) {
+        ++cur;
+    }
+    return cur;
+}
+
+bool MatchKeyword(const char*& cur, const char* end, const char* keyword)
+{
+    const size_t length = std::strlen(keyword);
+    if (static_cast<size_t>(end - cur) < length || std::strncmp(cur, keyword, length) != 0) {
+        return false;
+    }
+    cur += length;
+    return true;
+}
+
+// reads "(a b ...)" into args, returns the argument count or -1
+int ParseArgs(const char*& cur, const char* end, double (&args)[MAX_TRANSFORM_ARGS])
+{
+    cur = SkipSpaces(cur, end);
+    if (cur == end || *cur != '(') {
+        return -1;
+    }
+    cur = SkipSpaces(cur + 1, end);
+    int count = 0;
+    while (cur < end && *cur != ')') {
+        if (count == MAX_TRANSFORM_ARGS) {
+            return -1;
+        }
+        char* numberEnd = nullptr;
+        args[count] = std::strtod(cur, &numberEnd);
+        if (numberEnd == cur) {
+            return -1;
+        }
+        ++count;
+        cur = SkipSeparators(numberEnd, end);
+    }
+    if (cur == end) {
+        return -1;
+    }
+    ++cur;
+    return count;
+}
+
+bool ParseTransform(const char*& cur, const char* end, AffineTransform& transform)
+{
+    double args[MAX_TRANSFORM_ARGS];
+    int count = 0;
+    if (MatchKeyword(cur, end, "matrix")) {
+        if ((count = ParseArgs(cur, end, args)) != 6) {
+            return false;
+        }
+        transform = {args[0], args[1], args[2], args[3], args[4], args[5]};
+    } else if (MatchKeyword(cur, end, "translate")) {
+        if ((count = ParseArgs(cur, end, args)) != 1 && count != 2) {
+            return false;
+        }
+        transform = AffineTransform::Translate(args[0], count == 2 ? args[1] : 0.0);
+    } else if (MatchKeyword(cur, end, "scale")) {
+        if ((count = ParseArgs(cur, end, args)) != 1 && count != 2) {
+            return false;
+        }
+        transform = AffineTransform::Scale(args[0], count == 2 ? args[1] : args[0]);
+    } else if (MatchKeyword(cur, end, "rotate")) {
+        if ((count = ParseArgs(cur, end, args)) != 1 && count != 3) {
+            return false;
+        }
+        transform = AffineTransform::Rotate(args[0]);
+        if (count == 3) {
+            transform = AffineTransform::Translate(args[1], args[2]) * transform *
+                        AffineTransform::Translate(-args[1], -args[2]);
+        }
+    } else if (MatchKeyword(cur, end, "skewX")) {
+        if (ParseArgs(cur, end, args) != 1) {
+            return false;
+        }
+        transform = AffineTransform::Skew(args[0], 0.0);
+    } else if (MatchKeyword(cur, end, "skewY")) {
+        if (ParseArgs(cur, end, args) != 1) {
+            return false;
+        }
+        transform = AffineTransform::Skew(0.0, args[0]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// one transform-origin component, horizontal tells which keywords are valid
+bool ParseOriginValue(const char*& cur, const char* end, bool horizontal, Dimension& value)
+{
+    static const struct {
+        const char* keyword;
+        double percent;
+        int axis; // 0 horizontal, 1 vertical, 2 both
+    } KEYWORDS[] = {
+        {"left", 0.0, 0}, {"right", 1.0, 0}, {"top", 0.0, 1}, {"bottom", 1.0, 1}, {"center", 0.5, 2},
+    };
+    for (const auto& keyword : KEYWORDS) {
+        if ((keyword.axis == 2 || keyword.axis == (horizontal ? 0 : 1)) && MatchKeyword(cur, end, keyword.keyword)) {
+            value = Dimension(keyword.percent, DimensionUnit::PERCENT);
+            return true;
+        }
+    }
+    char* numberEnd = nullptr;
+    const double number = std::strtod(cur, &numberEnd);
+    if (numberEnd == cur) {
+        return false;
+    }
+    cur = numberEnd;
+    if (cur < end && *cur == '%') {
+        ++cur;
+        value = Dimension(number / 100.0, DimensionUnit::PERCENT);
+    } else {
+        MatchKeyword(cur, end, "px");
+        value = Dimension(number, DimensionUnit::PX);
+    }
+    return true;
+}
+} // namespace
+
+bool ParseTransformList(const std::string& value, AffineTransform& transform)
+{
+    transform = AffineTransform();
+    const char* cur = value.c_str();
+    const char* end = cur + value.size();
+    cur = SkipSeparators(cur, end);
+    while (cur < end) {
+        AffineTransform item;
+        if (!ParseTransform(cur, end, item)) {
+            transform = AffineTransform();
+            return false;
+        }
+        transform *= item;
+        cur = SkipSeparators(cur, end);
+    }
+    return true;
+}
+
+bool ParseTransformOrigin(const std::string& value, TransformOrigin& origin)
+{
+    const char* cur = value.c_str();
+    const char* end = cur + value.size();
+    cur = SkipSpaces(cur, end);
+    Dimension first;
+    Dimension second(0.5, DimensionUnit::PERCENT);
+    // "top left" names the vertical keyword first
+    bool swapped = false;
+    if (!ParseOriginValue(cur, end, true, first)) {
+        if (!ParseOriginValue(cur, end, false, first)) {
+            return false;
+        }
+        swapped = true;
+    }
+    cur = SkipSpaces(cur, end);
+    if (cur < end && !ParseOriginValue(cur, end, swapped, second)) {
+        return false;
+    }
+    origin.x = swapped ? second : first;
+    origin.y = swapped ? first : second;
+    return true;
+}
+
+} // namespace rnoh
@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include "properties/AffineTransform.h"
+#include "properties/Dimension.h"
+
+namespace rnoh {
+
+// Parses an SVG transform list such as "translate(10 20) rotate(45 5 5)" in
+// one pass without allocating. Lengths are in user units. On a syntax error
+// transform is reset to identity and false is returned, as the attribute is
+// then ignored.
+bool ParseTransformList(const std::string& value, AffineTransform& transform);
+
+struct TransformOrigin {
+    Dimension x = Dimension(0.0, DimensionUnit::PX);
+    Dimension y = Dimension(0.0, DimensionUnit::PX);
+};
+
+// Parses transform-origin keywords, percentages and lengths, e.g. "center",
+// "left 20%" or "10 5". A missing second value means center.
+bool ParseTransformOrigin(const std::string& value, TransformOrigin& origin);
+
+} // namespace rnoh
@@ -2,6 +2,11 @@
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace rnoh {
 
@@ -10,6 +15,77 @@ inline double vpToPx(double vp) {
     return vp * 3.25010318;
 }
 
+template<typename T>
+inline void HashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Two 64-bit hashes mixed independently of each other, for keys shared
+// between documents where a collision would show the wrong content.
+struct WideHash {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const WideHash& other) const
+    {
+        return low == other.low && high == other.high;
+    }
+    bool operator!=(const WideHash& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// FNV-1a, the high lane of WideHash; std::hash feeds the low one
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template<typename C>
+inline uint64_t HashBytes(const std::basic_string<C>& value)
+{
+    return HashBytes(value.data(), value.size() * sizeof(C));
+}
+
+inline uint64_t HashBytes(std::string_view value)
+{
+    return HashBytes(value.data(), value.size());
+}
+
+template<typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
+inline uint64_t HashBytes(const T& value)
+{
+    return HashBytes(&value, sizeof(T));
+}
+
+inline void MixHigh(WideHash& seed, uint64_t value)
+{
+    // splitmix64 finalizer
+    uint64_t x = seed.high ^ (value + 0x9e3779b97f4a7c15ULL);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    seed.high = x ^ (x >> 31);
+}
+
+template<typename T>
+inline void HashCombine(WideHash& seed, const T& value)
+{
+    seed.low ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed.low << 6) + (seed.low >> 2);
+    MixHigh(seed, HashBytes(value));
+}
+
+inline void HashCombine(WideHash& seed, const WideHash& value)
+{
+    seed.low ^= value.low + 0x9e3779b9 + (seed.low << 6) + (seed.low >> 2);
+    MixHigh(seed, value.high);
+}
+
 template<typename T, std::size_t N>
 constexpr std::size_t ArraySize(T (&)[N]) noexcept
 {
@@ -0,0 +1,43 @@
+#include "ViewBox.h"
+#include <algorithm>
+
+namespace rnoh {
+namespace {
+// fraction of the free space placed before the viewBox for xMin/xMid/xMax
+double AlignFactor(const std::string& align, const char* mid, const char* max)
+{
+    if (align.find(mid) != std::string::npos) {
+        return 0.5;
+    }
+    if (align.find(max) != std::string::npos) {
+        return 1.0;
+    }
+    return 0.0;
+}
+} // namespace
+
+ViewBoxTransform ResolveViewBox(const Rect& viewBox, const Size& viewPort, const std::string& align,
+                                MeetOrSlice meetOrSlice)
+{
+    ViewBoxTransform transform;
+    if (!viewBox.IsValid() || !viewPort.IsValid()) {
+        return transform;
+    }
+    transform.scaleX = viewPort.Width() / viewBox.Width();
+    transform.scaleY = viewPort.Height() / viewBox.Height();
+    if (align != "none" && meetOrSlice != MeetOrSlice::NONE) {
+        const double scale = meetOrSlice == MeetOrSlice::SLICE ? std::max(transform.scaleX, transform.scaleY)
+                                                               : std::min(transform.scaleX, transform.scaleY);
+        transform.scaleX = scale;
+        transform.scaleY = scale;
+    }
+    // RNSVG leaves align empty for the default xMidYMid
+    const std::string alignment = align.empty() ? "xMidYMid" : align;
+    transform.translateX = -viewBox.Left() * transform.scaleX +
+                           (viewPort.Width() - viewBox.Width() * transform.scaleX) * AlignFactor(alignment, "xMid", "xMax");
+    transform.translateY = -viewBox.Top() * transform.scaleY +
+                           (viewPort.Height() - viewBox.Height() * transform.scaleY) * AlignFactor(alignment, "YMid", "YMax");
+    return transform;
+}
+
+} // namespace rnoh
@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include "properties/Rect.h"
+#include "properties/Size.h"
+
+namespace rnoh {
+
+// RNSVG meetOrSlice values
+enum class MeetOrSlice {
+    MEET = 0,
+    SLICE = 1,
+    NONE = 2,
+};
+
+// Maps viewBox coordinates into a viewport: p' = p * scale + translate.
+struct ViewBoxTransform {
+    double scaleX = 1.0;
+    double scaleY = 1.0;
+    double translateX = 0.0;
+    double translateY = 0.0;
+};
+
+// preserveAspectRatio resolution, align is one of "none", "xMinYMin" ...
+// "xMaxYMax" as sent by RNSVG.
+ViewBoxTransform ResolveViewBox(const Rect& viewBox, const Size& viewPort, const std::string& align,
+                                MeetOrSlice meetOrSlice);
+
+} // namespace rnoh
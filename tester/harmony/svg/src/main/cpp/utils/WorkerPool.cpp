@@ -0,0 +1,243 @@
+#include "WorkerPool.h"
+#include <sched.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace rnoh {
+namespace {
+// used when the cores cannot be told apart, leaves cores to the UI and
+// render threads
+constexpr unsigned MAX_WORKERS = 4;
+
+// Cores with the highest peak frequencies, everything but the little
+// cluster. Empty when cpufreq is unreadable or all cores are alike.
+std::vector<int> FindBigCores()
+{
+    const unsigned count = std::thread::hardware_concurrency();
+    std::vector<long> maxFreqs;
+    for (unsigned cpu = 0; cpu < count; ++cpu) {
+        std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/cpuinfo_max_freq");
+        long freq = 0;
+        if (!(file >> freq)) {
+            return {};
+        }
+        maxFreqs.push_back(freq);
+    }
+    if (maxFreqs.empty()) {
+        return {};
+    }
+    const auto [littleFreq, bigFreq] = std::minmax_element(maxFreqs.begin(), maxFreqs.end());
+    if (*littleFreq == *bigFreq) {
+        return {};
+    }
+    std::vector<int> cores;
+    for (unsigned cpu = 0; cpu < count; ++cpu) {
+        if (maxFreqs[cpu] > *littleFreq) {
+            cores.push_back(static_cast<int>(cpu));
+        }
+    }
+    return cores;
+}
+
+// [begin, end) packed in one word: the owner pops from the front and thieves
+// split off the back half, each with a single compare-exchange.
+class StealRange {
+public:
+    void Reset(uint32_t begin, uint32_t end)
+    {
+        range_.store(Pack(begin, end));
+    }
+
+    uint32_t Remaining() const
+    {
+        const uint64_t value = range_.load();
+        return Begin(value) < End(value) ? End(value) - Begin(value) : 0;
+    }
+
+    bool Pop(uint32_t& index)
+    {
+        uint64_t value = range_.load();
+        while (Begin(value) < End(value)) {
+            if (range_.compare_exchange_weak(value, Pack(Begin(value) + 1, End(value)))) {
+                index = Begin(value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool StealHalf(uint32_t& begin, uint32_t& end)
+    {
+        uint64_t value = range_.load();
+        while (Begin(value) < End(value)) {
+            const uint32_t mid = Begin(value) + (End(value) - Begin(value)) / 2;
+            if (range_.compare_exchange_weak(value, Pack(Begin(value), mid))) {
+                begin = mid;
+                end = End(value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t Pack(uint32_t begin, uint32_t end)
+    {
+        return (static_cast<uint64_t>(begin) << 32) | end;
+    }
+    static uint32_t Begin(uint64_t value)
+    {
+        return static_cast<uint32_t>(value >> 32);
+    }
+    static uint32_t End(uint64_t value)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    std::atomic<uint64_t> range_{0};
+};
+
+// shared by the participants of one ParallelFor, helpers that start late
+// keep it alive and find nothing left to do
+struct ParallelJob {
+    ParallelJob(size_t count, size_t participants, const std::function<void(size_t)>& fn)
+        : fn(fn), count(count), participants(participants), ranges(new StealRange[participants])
+    {
+        for (size_t i = 0; i < participants; ++i) {
+            ranges[i].Reset(static_cast<uint32_t>(count * i / participants),
+                            static_cast<uint32_t>(count * (i + 1) / participants));
+        }
+    }
+
+    void Participate(size_t slot)
+    {
+        auto& own = ranges[slot];
+        while (true) {
+            uint32_t index = 0;
+            while (own.Pop(index)) {
+                fn(index);
+                if (done.fetch_add(1) + 1 == count) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished.notify_all();
+                }
+            }
+            size_t victim = slot;
+            uint32_t most = 0;
+            for (size_t i = 0; i < participants; ++i) {
+                const uint32_t remaining = ranges[i].Remaining();
+                if (i != slot && remaining > most) {
+                    victim = i;
+                    most = remaining;
+                }
+            }
+            uint32_t begin = 0;
+            uint32_t end = 0;
+            if (victim == slot) {
+                return;
+            }
+            if (ranges[victim].StealHalf(begin, end)) {
+                own.Reset(begin, end);
+            }
+        }
+    }
+
+    const std::function<void(size_t)>& fn;
+    const size_t count;
+    const size_t participants;
+    std::unique_ptr<StealRange[]> ranges;
+    std::atomic<size_t> done{0};
+    std::atomic<size_t> nextSlot{1}; // slot 0 is the caller's
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+} // namespace
+
+WorkerPool& WorkerPool::GetInstance()
+{
+    static WorkerPool pool;
+    return pool;
+}
+
+WorkerPool::WorkerPool() : bigCores_(FindBigCores())
+{
+    unsigned count = static_cast<unsigned>(bigCores_.size());
+    if (count == 0) {
+        const unsigned cores = std::thread::hardware_concurrency();
+        count = std::clamp(cores > 1 ? cores - 1 : 1u, 1u, MAX_WORKERS);
+    }
+    for (unsigned i = 0; i < count; ++i) {
+        threads_.emplace_back([this] { Run(); });
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkerPool::Post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& fn)
+{
+    if (count == 0) {
+        return;
+    }
+    const size_t helpers = std::min(threads_.size(), count - 1);
+    if (helpers == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+    auto job = std::make_shared<ParallelJob>(count, helpers + 1, fn);
+    for (size_t i = 0; i < helpers; ++i) {
+        Post([job] { job->Participate(job->nextSlot.fetch_add(1)); });
+    }
+    job->Participate(0);
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&job] { return job->done.load() == job->count; });
+}
+
+void WorkerPool::Run()
+{
+    if (!bigCores_.empty()) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (int cpu : bigCores_) {
+            CPU_SET(cpu, &cpus);
+        }
+        sched_setaffinity(0, sizeof(cpus), &cpus);
+    }
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (stopping_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace rnoh
@@ -0,0 +1,49 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rnoh {
+
+// Background threads shared by every document for work that must stay off
+// the UI thread. Tasks run in posting order, several at a time. There is one
+// thread per big core, pinned to the big cores where the platform tells them
+// apart.
+class WorkerPool {
+public:
+    static WorkerPool& GetInstance();
+
+    void Post(std::function<void()> task);
+
+    // Calls fn(i) for every i in [0, count) across the pool and the calling
+    // thread, returns once all calls finished. Each participant starts on its
+    // own contiguous range and steals half of the largest remaining range when
+    // done, so uneven items balance out. Safe to call from a pool thread.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    size_t GetThreadCount() const
+    {
+        return threads_.size();
+    }
+
+private:
+    WorkerPool();
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void Run();
+
+    std::vector<std::thread> threads_;
+    std::vector<int> bigCores_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopping_ = false;
+};
+
+} // namespace rnoh